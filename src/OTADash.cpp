@@ -38,12 +38,27 @@
 #include "OTADash.h"
 #include "WebPages.h"
 #include "WebPagesStyles.h"
+#include "WebAssets.h"
+
+OTA_DASH_TEMPLATE(indexTemplate, index_html);                                                                       // Split at compile time, see OTADashTemplate.h
+OTA_DASH_TEMPLATE(debugTemplate, debug_html);
+
+static_assert(sizeof(webpages_theme) / sizeof(webpages_theme[0]) == THEME_COLOR_COUNT, "webpages_theme must list every ThemeColor");
 
 #if OTADASH_DEBUG_ENABLED
    ChronoLogger *otaDashLogger = nullptr;
 #endif
 
 OTADash* OTADash::instance = nullptr;
+vprintf_like_t OTADash::previousVprintf = nullptr;
+
+#if OTA_DASH_LOG_PERSIST
+struct LogDownload {                                                                                                // Per request state of /logs/download
+    uint32_t segment;
+    uint32_t last;
+    File     file;
+};
+#endif
 
 OTADash::OTADash(const char* ssid, const char* password, const char* custom_domain, const char* portal_title) : 
     ssid            (ssid), 
@@ -54,8 +69,16 @@ OTADash::OTADash(const char* ssid, const char* password, const char* custom_doma
     dnsServer       (std::make_unique<DNSServer>()),
     customDomain    (String(custom_domain) + ".local"), 
     server          (std::make_unique<AsyncWebServer>(80)),
-    ws              (std::make_unique<AsyncWebSocket>("/ws")) {
+    ws              (std::make_unique<AsyncWebSocket>("/ws")),
+    events          (std::make_unique<AsyncEventSource>("/events")),
+    debugLog        (std::make_unique<OTADashLogBuffer>()) {
+    #if OTA_DASH_LOG_ARCHIVE
+        debugArchive = std::make_unique<OTADashLogArchive>();
+    #endif
     instance = this;
+    dashCommandsLock = xSemaphoreCreateMutex();                                                                     // onCommand() may run before begin()
+    pageValuesLock   = xSemaphoreCreateMutex();
+    updateThemeCss();
 
     #if OTADASH_DEBUG_ENABLED
         otaDashLogger = new ChronoLogger("OTADash", OTADASH_DEBUG_LEVEL);
@@ -65,6 +88,18 @@ OTADash::OTADash(const char* ssid, const char* password, const char* custom_doma
 
 OTADash::~OTADash() {
     stop();
+    if (dashClientsLock) {
+        vSemaphoreDelete(dashClientsLock);
+        dashClientsLock = nullptr;
+    }
+    if (dashCommandsLock) {
+        vSemaphoreDelete(dashCommandsLock);
+        dashCommandsLock = nullptr;
+    }
+    if (pageValuesLock) {
+        vSemaphoreDelete(pageValuesLock);
+        pageValuesLock = nullptr;
+    }
     OTADASH_LOGGER(debug, "OTADash Instance Destroyed");
     #if OTADASH_DEBUG_ENABLED
         delete otaDashLogger;
@@ -73,8 +108,12 @@ OTADash::~OTADash() {
 }
 
 void OTADash::stop() {
+    #if OTA_DASH_LOG_PERSIST
+        persistDebugLogs(true);
+    #endif
     if (serverStarted) {
         ws->closeAll();
+        events->close();
         server->end();
         dnsServer->stop();
         if (mdnsStarted) {
@@ -143,6 +182,25 @@ void OTADash::disconnectWifi() {
 void OTADash::begin(NetworkMode mode) {
     currentMode = mode;
     server->reset();
+
+    debugLog->setMaxRecords(debugLogsMax);
+    if (!debugLog->begin(debugLogBufferSize)) {
+        OTADASH_LOGGER(error, "Failed to allocate %u bytes for debug logs", (unsigned)debugLogBufferSize);
+    }
+    #if OTA_DASH_LOG_ARCHIVE
+        if (!debugArchive->begin(OTA_DASH_LOG_ARCHIVE_SIZE, debugLog->first())) {
+            OTADASH_LOGGER(error, "Failed to allocate %u bytes for the debug log archive", (unsigned)OTA_DASH_LOG_ARCHIVE_SIZE);
+        }
+    #endif
+    if (!dashClientsLock) {
+        dashClientsLock = xSemaphoreCreateMutex();
+    }
+    if (!dashMessages) {
+        dashMessages.reset(new (std::nothrow) uint8_t[OTA_DASH_WS_MAX_CLIENTS * OTA_DASH_WS_MESSAGE_MAX]);
+    }
+    debugLogBatch.reserve(debugFlushBytes + OTA_DASH_LOG_LINE_MAX * 2);
+    debugLogFrame.reserve(debugFlushBytes + OTA_DASH_LOG_PAYLOAD_MAX + 16);
+    captureDeviceFacts();
     
     OTADASH_LOGGER(info, "Starting server....");
 
@@ -195,19 +253,66 @@ void OTADash::begin(NetworkMode mode) {
         size_t len) {
 
         if (type == WS_EVT_DATA) {
-            AwsFrameInfo *info = (AwsFrameInfo *)arg;
-            if (info->opcode == WS_TEXT) {
-                data[len] = 0;
-                handleWebSocketMessage(arg, data, len);
-            }
+            touchDashClient(client->id());
+            receiveWebSocketData(client, (AwsFrameInfo *)arg, data, len);
+        } else if (type == WS_EVT_PONG) {
+            touchDashClient(client->id());
         } else if (type == WS_EVT_CONNECT) {
             OTADASH_LOGGER(info, "WebSocket client connected: ID=%u", client->id());
+            xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+            DashClient* slot = findDashClient(client->id(), true);                                                  // Legacy topics until it subscribes
+            if (slot) {
+                slot->lastSeen = millis();
+            }
+            xSemaphoreGive(dashClientsLock);
+
+            if (!slot) {
+                OTADASH_LOGGER(warn, "Too many WebSocket clients, closing ID=%u", client->id());
+                client->close(1013, "Too many clients");
+                return;
+            }
+            client->setCloseClientOnQueueFull(false);                                                               // Queue caps are enforced per client instead
         } else if (type == WS_EVT_DISCONNECT) {
             OTADASH_LOGGER(info, "WebSocket client disconnected: ID=%u", client->id());
+            releaseDashClient(client->id());
+        }
+    });
+
+    events->onConnect([this](AsyncEventSourceClient *client) {
+        uint32_t lastId = client->lastId();                                                                         // Last-Event-ID header, a log sequence
+        uint32_t cursor = lastId ? debugLog->seek(lastId + 1) : debugLog->first();
+        EventClient* slot = nullptr;
+
+        xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+        for (EventClient& entry : eventClients) {
+            if (!entry.client) {
+                slot = &entry;
+                slot->client    = client;
+                slot->logCursor = cursor;
+                break;
+            }
+        }
+        xSemaphoreGive(dashClientsLock);
+
+        if (!slot) {
+            OTADASH_LOGGER(warn, "Too many /events watchers");
+            client->close();
+            return;
+        }
+        OTADASH_LOGGER(info, "Events client connected, resuming after #%u", lastId);
+    });
+    events->onDisconnect([this](AsyncEventSourceClient *client) {
+        xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+        for (EventClient& entry : eventClients) {
+            if (entry.client == client) {
+                entry = {};
+            }
         }
+        xSemaphoreGive(dashClientsLock);
     });
 
     server->addHandler(ws.get());
+    server->addHandler(events.get());
     setupServer();
     server->begin();
     OTADASH_LOGGER(info, "Server started");
@@ -225,29 +330,998 @@ void OTADash::begin(NetworkMode mode) {
     }
     serverStarted = true;
 
-    xTaskCreatePinnedToCore(otaDashTask, "otaDashTask", 4096, instance, 1, NULL, 0);
+    xTaskCreatePinnedToCore(otaDashTask, "otaDashTask", OTA_DASH_TASK_STACK_SIZE, instance, OTA_DASH_TASK_PRIORITY, NULL, OTA_DASH_TASK_CORE);
 }
 
-void OTADash::printDebug(const String& message) {
-    if (serverStarted) {                                                                                           
-        
-        String formattedMessage = message;
-        formattedMessage.replace("\n", "<br/>");
-        formattedMessage.replace("\r", "");
-        formattedMessage.replace("\t", "&emsp;");
+void OTADash::printDebug(const char* message, DebugLevel level) {
+    if (message) {
+        appendDebugLog(level, nullptr, message, strlen(message));
+    }
+}
 
-        debugLogs += formattedMessage + "<br/>";
-        debugLogsCounter++;
-        
-        if (isOnDebugPage) {                                                                                            // Send to WebSocket clients if debug page is open
-            ws->textAll(formattedMessage);                                                                              // Send the formatted message to all WebSocket clients
+void OTADash::printDebug(const String& message, DebugLevel level) {
+    appendDebugLog(level, nullptr, message.c_str(), message.length());
+}
+
+void OTADash::printDebug(const Printable& value, DebugLevel level) {
+    if (serverStarted) {
+        OTADashLogLine line;
+        value.printTo(line);
+        appendDebugLog(level, nullptr, line.c_str(), line.length());
+    }
+}
+
+void OTADash::printDebugf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    vprintDebugf(DEBUG_LEVEL_INFO, nullptr, format, args);
+    va_end(args);
+}
+
+void OTADash::printDebugf(DebugLevel level, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    vprintDebugf(level, nullptr, format, args);
+    va_end(args);
+}
+
+void OTADash::printDebugTag(DebugLevel level, const char* tag, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    vprintDebugf(level, tag, format, args);
+    va_end(args);
+}
+
+void OTADash::vprintDebugf(DebugLevel level, const char* tag, const char* format, va_list args) {                                     // Formats on the stack, no heap allocation
+    if (!serverStarted) {
+        return;
+    }
+
+    char line[OTA_DASH_LOG_LINE_MAX + 1];
+    int len = vsnprintf(line, sizeof(line), format, args);
+    if (len > 0) {
+        appendDebugLog(level, tag, line, len < (int)sizeof(line) ? len : sizeof(line) - 1);
+    }
+}
+
+void OTADash::appendDebugLog(DebugLevel level, const char* tag, const char* text, size_t len) {
+    if (!serverStarted) {
+        return;
+    }
+
+    uint32_t now        = millis();
+    size_t tagLength    = tag ? strnlen(tag, OTA_DASH_LOG_TAG_MAX) : 0;
+    uint32_t tagHash    = otaDashHash(tag, tagLength);
+    uint32_t lineHash   = otaDashHash(text, len, tagHash ^ level);
+    uint32_t suppressed = 0;
+
+    portENTER_CRITICAL(&debugGateLock);
+    bool repeated = lineHash == debugLastHash && len == debugLastLength && level == debugRepeatLevel &&             // The hash only narrows it down, a collision
+                    memcmp(text, debugLastLine, len) == 0 && debugRepeatTag[tagLength] == '\0' &&                   // must not drop a different line
+                    memcmp(tag ? tag : "", debugRepeatTag, tagLength) == 0;
+    if (repeated && debugRepeatCount < UINT32_MAX) {                                                                // Same line again, only count it
+        if (debugRepeatCount++ == 0) {
+            debugRepeatSince = now;
+        }
+        debugLinesCollapsed++;
+        portEXIT_CRITICAL(&debugGateLock);
+        return;
+    }
+    portEXIT_CRITICAL(&debugGateLock);
+
+    flushDebugRepeats(true);                                                                                        // Report the run before the new line
+
+    portENTER_CRITICAL(&debugGateLock);
+    bool allowed = takeDebugToken(tagHash, now, suppressed);
+    if (allowed) {
+        debugLastHash    = lineHash;
+        debugLastLength  = len <= sizeof(debugLastLine) ? len : SIZE_MAX;                                           // Longer lines are never collapsed
+        debugRepeatLevel = level;
+        memcpy(debugLastLine, text, len <= sizeof(debugLastLine) ? len : 0);
+        memcpy(debugRepeatTag, tag ? tag : "", tagLength);
+        debugRepeatTag[tagLength] = '\0';
+    } else {
+        debugLinesDropped++;
+    }
+    portEXIT_CRITICAL(&debugGateLock);
+
+    if (!allowed) {
+        return;
+    }
+
+    uint8_t core = xPortGetCoreID();
+    if (suppressed > 0) {
+        char notice[48];
+        int noticeLength = snprintf(notice, sizeof(notice), "%u lines dropped by rate limit", (unsigned)suppressed);
+        debugLog->append(tag, notice, noticeLength, now, DEBUG_LEVEL_WARN, core);
+    }
+    debugLog->append(tag, text, len, now, level, core);                                                             // Sent later by flushDebugLogs() from otaDashTask
+}
+
+void OTADash::flushDebugRepeats(bool force) {                                                                         // Emit "last message repeated N times"
+    uint32_t now = millis();
+    uint32_t repeated = 0;
+    uint8_t level;
+    char tag[OTA_DASH_LOG_TAG_MAX + 1];
+
+    portENTER_CRITICAL(&debugGateLock);
+    if (debugRepeatCount > 0 && (force || now - debugRepeatSince >= OTA_DASH_LOG_REPEAT_WINDOW)) {
+        repeated = debugRepeatCount;
+        level    = debugRepeatLevel;
+        memcpy(tag, debugRepeatTag, sizeof(tag));
+        debugRepeatCount = 0;
+        if (force) {
+            debugLastHash   = 0;
+            debugLastLength = SIZE_MAX;
+        }
+    }
+    portEXIT_CRITICAL(&debugGateLock);
+
+    if (repeated > 0) {
+        char notice[48];
+        int noticeLength = snprintf(notice, sizeof(notice), "last message repeated %u times", (unsigned)repeated);
+        debugLog->append(tag, notice, noticeLength, now, level, xPortGetCoreID());
+    }
+}
+
+bool OTADash::takeDebugToken(uint32_t tagHash, uint32_t now, uint32_t& suppressed) {                                 // Caller must hold debugGateLock
+    if (debugRateLimit == 0) {
+        return true;
+    }
+
+    DebugRateSource* source = nullptr;
+    DebugRateSource* oldest = &debugRateSources[0];
+    for (DebugRateSource& candidate : debugRateSources) {
+        if (candidate.active && candidate.tagHash == tagHash) {
+            source = &candidate;
+            break;
+        }
+        if (!candidate.active || (oldest->active && now - candidate.lastRefill > now - oldest->lastRefill)) {
+            oldest = &candidate;
+        }
+    }
+
+    uint32_t capacity = (uint32_t)debugRateBurst * 1000;
+    if (!source) {                                                                                                  // New tag, recycle the least recently seen bucket
+        source = oldest;
+        *source = { true, tagHash, capacity, now, 0 };
+    }
+
+    uint32_t elapsed = now - source->lastRefill;
+    uint32_t refill  = (elapsed < capacity ? elapsed : capacity) * debugRateLimit;                                  // Clamped so long idle periods cannot overflow
+    source->tokens     = capacity - source->tokens > refill ? source->tokens + refill : capacity;
+    source->lastRefill = now;
+
+    if (source->tokens < 1000) {
+        source->dropped++;
+        return false;
+    }
+    source->tokens -= 1000;
+    suppressed = source->dropped;
+    source->dropped = 0;
+    return true;
+}
+
+void OTADash::captureEspLogs(bool enable) {
+    if (enable && !previousVprintf) {
+        previousVprintf = esp_log_set_vprintf(captureEspLog);
+    } else if (!enable && previousVprintf) {
+        esp_log_set_vprintf(previousVprintf);
+        previousVprintf = nullptr;
+    }
+}
+
+int OTADash::captureEspLog(const char* format, va_list args) {                                                        // "\033[0;31mE (1234) wifi: message\033[0m\n"
+    int printed = 0;
+    if (previousVprintf) {
+        va_list copy;
+        va_copy(copy, args);
+        printed = previousVprintf(format, copy);
+        va_end(copy);
+    }
+
+    if (!instance || xPortInIsrContext()) {
+        return printed;
+    }
+
+    char line[OTA_DASH_LOG_LINE_MAX + 1];
+    int formatted = vsnprintf(line, sizeof(line), format, args);
+    if (formatted <= 0) {
+        return printed;
+    }
+
+    char* text = line;
+    char* end  = line + (formatted < (int)sizeof(line) ? formatted : sizeof(line) - 1);
+    while (end > text && (end[-1] == '\n' || end[-1] == '\r')) end--;
+    if (end - text >= 4 && memcmp(end - 4, "\033[0m", 4) == 0) end -= 4;                                           // Colour reset
+    if (*text == '\033') {
+        while (text < end && *text != 'm') text++;
+        if (text < end) text++;
+    }
+
+    DebugLevel level = DEBUG_LEVEL_INFO;
+    const char* tag  = "esp";
+    if (end - text > 4 && text[1] == ' ' && text[2] == '(') {
+        switch (text[0]) {
+            case 'E': level = DEBUG_LEVEL_ERROR;   break;
+            case 'W': level = DEBUG_LEVEL_WARN;    break;
+            case 'I': level = DEBUG_LEVEL_INFO;    break;
+            case 'D': level = DEBUG_LEVEL_DEBUG;   break;
+            case 'V': level = DEBUG_LEVEL_VERBOSE; break;
+        }
+        char* close = static_cast<char*>(memchr(text, ')', end - text));
+        char* colon = close ? static_cast<char*>(memchr(close, ':', end - close)) : nullptr;
+        if (close && colon && close[1] == ' ') {
+            *colon = '\0';
+            tag    = close + 2;
+            text   = colon + 1;
+            if (text < end && *text == ' ') text++;
+        }
+    }
+
+    if (end > text) {
+        instance->appendDebugLog(level, tag, text, end - text);
+    }
+    return printed;
+}
+
+size_t OTADashLogTee::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t OTADashLogTee::write(const uint8_t* buffer, size_t size) {
+    size_t written = output ? output->write(buffer, size) : size;
+    char line[OTA_DASH_LOG_LINE_MAX + 1];
+    size_t start = 0;
+
+    for (size_t i = 0; i <= size; i++) {
+        if (i < size && buffer[i] != '\n') {
+            continue;
+        }
+
+        size_t length = 0;
+        portENTER_CRITICAL(&lock);                                                                                  // Several tasks may print at once
+        pending.write(buffer + start, i - start);
+        if (i < size) {
+            length = pending.length();
+            memcpy(line, pending.c_str(), length);
+            pending.clear();
+        }
+        portEXIT_CRITICAL(&lock);
+
+        while (length > 0 && line[length - 1] == '\r') length--;
+        if (length > 0 && OTADash::instance) {
+            OTADash::instance->appendDebugLog(level, tag, line, length);
+        }
+        start = i + 1;
+    }
+    return written;
+}
+
+size_t OTADash::formatDebugLine(char* out, size_t size, const OTADashLogRecord& record, const char* payload) {       // "<seconds>.<ms> <level> [tag] text\n"
+    static const char levels[] = "NEWIDV";
+    int len = snprintf(
+        out, size, "%lu.%03lu %c %s%.*s%s%.*s\n",
+        (unsigned long)(record.timestamp / 1000), (unsigned long)(record.timestamp % 1000),
+        levels[record.level < sizeof(levels) - 1 ? record.level : 0],
+        record.tagLength ? "[" : "", (int)record.tagLength, payload, record.tagLength ? "] " : "",
+        (int)(record.length - record.tagLength), payload + record.tagLength
+    );
+    return len < 0 ? 0 : len < (int)size ? len : size - 1;
+}
+
+#if OTA_DASH_LOG_PERSIST
+bool OTADash::enableDebugLogPersistence(size_t segmentSize, uint8_t segmentCount) {
+    if (!LittleFS.begin(true)) {
+        OTADASH_LOGGER(error, "LittleFS mount failed, debug logs will not be persisted");
+        return false;
+    }
+    LittleFS.mkdir(OTA_DASH_LOG_PERSIST_DIR);
+
+    persistSegmentSize  = segmentSize > OTA_DASH_LOG_PERSIST_BLOCK ? segmentSize : OTA_DASH_LOG_PERSIST_BLOCK;
+    persistSegmentCount = segmentCount > 1 ? segmentCount : 2;
+    persistSegment      = 0;
+
+    File dir = LittleFS.open(OTA_DASH_LOG_PERSIST_DIR);                                                            // Continue after the newest segment from the last boot
+    for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+        uint32_t segment = strtoul(entry.name(), nullptr, 10);
+        if (segment > persistSegment) {
+            persistSegment = segment;
+        }
+    }
+
+    if (!persistBuffer) {
+        persistBuffer.reset(new uint8_t[OTA_DASH_LOG_PERSIST_BLOCK]);
+    }
+
+    char path[48];
+    segmentPath(path, sizeof(path), persistSegment);
+    File tail = LittleFS.open(path, FILE_READ);                                                                     // Refill a partial last block, so new lines keep it whole
+    size_t size = tail ? tail.size() : 0;
+    persistUsed        = size % OTA_DASH_LOG_PERSIST_BLOCK;
+    persistBlockOffset = size - persistUsed;
+    if (persistUsed > 0) {
+        tail.seek(persistBlockOffset);
+        persistUsed = tail.read(persistBuffer.get(), persistUsed);
+    }
+    if (tail) {
+        tail.close();
+    }
+    persistWritten = persistUsed;
+    if (persistUsed == 0 && size >= persistSegmentSize) {
+        nextPersistSegment();
+    }
+
+    persistCursor    = debugLog->first();
+    persistLastWrite = millis();
+    persistEnabled   = true;
+    OTADASH_LOGGER(info, "Persisting debug logs to %s, segment %u", OTA_DASH_LOG_PERSIST_DIR, persistSegment);
+    return true;
+}
+
+void OTADash::persistDebugLogs(bool force) {                                                                          // Runs in otaDashTask, never from printDebug
+    if (!persistEnabled) {
+        return;
+    }
+
+    OTADashLogRecord record;
+    char payload[OTA_DASH_LOG_PAYLOAD_MAX + 1];
+    char line[OTA_DASH_LOG_PAYLOAD_MAX + 32];
+
+    while (debugLog->read(persistCursor, record, payload, sizeof(payload))) {
+        size_t len    = formatDebugLine(line, sizeof(line), record, payload);
+        size_t copied = 0;
+        while (copied < len) {                                                                                      // Lines may straddle two blocks
+            size_t take = OTA_DASH_LOG_PERSIST_BLOCK - persistUsed;
+            if (take > len - copied) take = len - copied;
+            memcpy(persistBuffer.get() + persistUsed, line + copied, take);
+            persistUsed += take;
+            copied      += take;
+            if (persistUsed == OTA_DASH_LOG_PERSIST_BLOCK) {
+                writePersistBlock();
+            }
+        }
+    }
+
+    if (persistFlushRequested || force || millis() - persistLastWrite >= OTA_DASH_LOG_PERSIST_INTERVAL) {
+        persistFlushRequested = false;
+        if (persistUsed > persistWritten) {                                                                         // Partial block, rewritten in place once it fills
+            writePersistBlock();
+        }
+        persistLastWrite = millis();
+    }
+}
+
+void OTADash::writePersistBlock() {                                                                                 // Blocks always start at a multiple of OTA_DASH_LOG_PERSIST_BLOCK
+    char path[48];
+    segmentPath(path, sizeof(path), persistSegment);
+
+    File file = LittleFS.open(path, persistBlockOffset > 0 || persistWritten > 0 ? "r+" : FILE_WRITE);
+    if (!file) {
+        OTADASH_LOGGER(error, "Failed to open %s", path);
+        persistUsed    = 0;
+        persistWritten = 0;
+        return;
+    }
+    file.seek(persistBlockOffset);
+    file.write(persistBuffer.get(), persistUsed);
+    file.close();
+
+    persistWritten   = persistUsed;
+    persistLastWrite = millis();
+    if (persistUsed < OTA_DASH_LOG_PERSIST_BLOCK) {
+        return;
+    }
+
+    persistUsed         = 0;
+    persistWritten      = 0;
+    persistBlockOffset += OTA_DASH_LOG_PERSIST_BLOCK;
+    if (persistBlockOffset >= persistSegmentSize) {
+        nextPersistSegment();
+    }
+}
+
+void OTADash::nextPersistSegment() {                                                                                // Rotate and drop the oldest segment
+    persistSegment++;
+    persistBlockOffset = 0;
+    if (persistSegment >= persistSegmentCount) {
+        char path[48];
+        segmentPath(path, sizeof(path), persistSegment - persistSegmentCount);
+        LittleFS.remove(path);
+    }
+}
+
+void OTADash::segmentPath(char* out, size_t size, uint32_t segment) {
+    snprintf(out, size, "%s/%lu.log", OTA_DASH_LOG_PERSIST_DIR, (unsigned long)segment);
+}
+#endif
+
+void OTADash::setDebugRateLimit(uint16_t linesPerSecond, uint16_t burst) {
+    portENTER_CRITICAL(&debugGateLock);
+    debugRateLimit = linesPerSecond;
+    debugRateBurst = burst > 0 ? burst : 1;
+    memset(debugRateSources, 0, sizeof(debugRateSources));
+    portEXIT_CRITICAL(&debugGateLock);
+}
+
+void OTADash::flushDebugLogs() {
+    flushDebugRepeats(false);
+
+    uint32_t newest = debugLog->last();
+    uint32_t now    = millis();
+    bool due        = now - debugLastFlush >= debugFlushInterval;
+
+    if (!dashClientsLock) {
+        debugLastFlush = now;
+        return;
+    }
+
+    DashClient targets[OTA_DASH_WS_MAX_CLIENTS];                                                                    // Copied out, frames are built and sent without the lock
+    uint32_t   startCursor[OTA_DASH_WS_MAX_CLIENTS];
+    uint32_t   startReplay[OTA_DASH_WS_MAX_CLIENTS];
+    size_t     count = 0;
+
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+    for (const DashClient& slot : dashClients) {
+        bool waiting = slot.logCursor != newest && (due || newest - slot.logCursor >= debugFlushBytes);             // Otherwise wait for more lines to share the frame
+        if (slot.id != 0 && (slot.replaySequence != 0 || ((slot.topics & (1u << DASH_TOPIC_LOGS)) && waiting))) {
+            targets[count]     = slot;
+            startCursor[count] = slot.logCursor;
+            startReplay[count] = slot.replaySequence;
+            count++;
+        }
+    }
+    xSemaphoreGive(dashClientsLock);
+
+    bool batchReady     = false;
+    bool batchBinary    = false;
+    uint32_t batchStart = 0;
+    uint32_t batchEnd   = 0;
+    uint32_t batchLines = 0;
+    const DebugFilter* batchFilter = nullptr;
+    AsyncWebSocketSharedBuffer batchBuffer;                                                                         // One copy of the frame for every client that shares it
+
+    for (size_t i = 0; i < count; i++) {
+        DashClient& target = targets[i];
+        bool backlogged    = false;
+        if (!checkDashClient(target.id, backlogged)) {
+            continue;
+        }
+        #if OTA_DASH_LOG_ARCHIVE
+        if (target.replaySequence != 0) {
+            if (!backlogged) {
+                replayDebugArchive(target);
+                batchReady = false;                                                                                 // Replay reused the batch buffers
+            }
+            continue;
+        }
+        #endif
+        if (backlogged) {                                                                                           // Drop its oldest unsent lines, keep the newest
+            OTADashLogRecord record;
+            while (newest - target.logCursor > debugFlushBytes * OTA_DASH_WS_QUEUE_MESSAGES && debugLog->read(target.logCursor, record, nullptr, 0)) {
+                wsLinesSkipped++;
+            }
+            continue;
+        }
+
+        if (!batchReady || target.logCursor != batchStart || target.binaryLogs != batchBinary ||                    // Clients at the same position and filter share one batch
+            memcmp(&target.filter, batchFilter, sizeof(DebugFilter)) != 0) {
+            batchStart  = batchEnd = target.logCursor;
+            batchBinary = target.binaryLogs;
+            batchFilter = &target.filter;
+            batchLines  = buildDebugBatch(batchEnd, batchBinary, target.filter);
+            batchBuffer = batchLines > 0 ? shareDebugBatch(batchBinary) : nullptr;
+            batchReady  = true;
+        }
+        if (batchBuffer) {
+            sendDashFrame(target.id, batchBinary, batchBuffer);
+        }
+        target.logCursor = batchEnd;
+    }
+
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+    for (size_t i = 0; i < count; i++) {
+        DashClient* slot = findDashClient(targets[i].id, false);
+        if (slot && slot->logCursor == startCursor[i] && slot->replaySequence == startReplay[i]) {                  // Unless a "resume" moved it meanwhile
+            slot->logCursor      = targets[i].logCursor;
+            slot->replaySequence = targets[i].replaySequence;
+        }
+    }
+    xSemaphoreGive(dashClientsLock);
+
+    if (due) {
+        debugLastFlush = now;
+    }
+}
+
+/*
+ * Text frames:   "[tag] " and escaped text per line joined by <br/>, followed by "\n@<last sequence>".
+ * Binary frames: version byte, then per record little endian
+ *                sequence u32 | timestamp u32 | level u8 | core u8 | tag length u8 | text length u16 | tag | text
+ */
+uint32_t OTADash::buildDebugBatch(uint32_t& cursor, bool binary, const DebugFilter& filter) {
+    OTADashLogRecord record;
+    char line[OTA_DASH_LOG_PAYLOAD_MAX + 1];
+    uint32_t lines        = 0;
+    uint32_t lastSequence = 0;
+
+    startDebugBatch();
+    while (debugLog->read(cursor, record, line, sizeof(line))) {
+        if (record.level > filter.level || !matchesDebugFilter(filter, line, record.tagLength)) {
+            continue;
+        }
+        lastSequence = record.sequence;
+        lines++;
+        if (!addDebugRecord(record, line, binary, lines)) {
+            break;
+        }
+    }
+    finishDebugBatch(binary, lines, lastSequence);
+    return lines;
+}
+
+AsyncWebSocketSharedBuffer OTADash::shareDebugBatch(bool binary) {
+    if (binary) {
+        return std::make_shared<std::vector<uint8_t>>(debugLogFrame);
+    }
+    const uint8_t* text = reinterpret_cast<const uint8_t*>(debugLogBatch.c_str());
+    return std::make_shared<std::vector<uint8_t>>(text, text + debugLogBatch.length());
+}
+
+void OTADash::startDebugBatch() {
+    debugLogBatch = "";
+    debugLogFrame.clear();
+    debugLogFrame.push_back(OTA_DASH_LOG_FRAME_VERSION);
+}
+
+bool OTADash::addDebugRecord(const OTADashLogRecord& record, const char* line, bool binary, uint32_t lines) {        // False once the batch reached debugFlushBytes
+    size_t textLength = record.length - record.tagLength;
+
+    if (binary) {
+        uint8_t header[13] = {
+            (uint8_t)(record.sequence),  (uint8_t)(record.sequence >> 8),  (uint8_t)(record.sequence >> 16),  (uint8_t)(record.sequence >> 24),
+            (uint8_t)(record.timestamp), (uint8_t)(record.timestamp >> 8), (uint8_t)(record.timestamp >> 16), (uint8_t)(record.timestamp >> 24),
+            (uint8_t)record.level, (uint8_t)record.core, record.tagLength,
+            (uint8_t)(textLength),       (uint8_t)(textLength >> 8)
+        };
+        debugLogFrame.insert(debugLogFrame.end(), header, header + sizeof(header));
+        debugLogFrame.insert(debugLogFrame.end(), line, line + record.length);
+        return debugLogFrame.size() < debugFlushBytes;
+    }
+
+    if (lines > 1) {
+        debugLogBatch += "<br/>";
+    }
+    if (record.tagLength > 0) {
+        debugLogBatch += "[";
+        appendDebugHtml(debugLogBatch, line, record.tagLength);
+        debugLogBatch += "] ";
+    }
+    appendDebugHtml(debugLogBatch, line + record.tagLength, textLength);
+    return debugLogBatch.length() < debugFlushBytes;
+}
+
+void OTADash::finishDebugBatch(bool binary, uint32_t lines, uint32_t lastSequence) {
+    if (lines > 0) {
+        if (!binary) {
+            debugLogBatch += "\n@";
+            debugLogBatch += String(lastSequence);
+        }
+        debugLinesCoalesced += lines - 1;
+    }
+}
+
+#if OTA_DASH_LOG_ARCHIVE
+void OTADash::replayDebugArchive(DashClient& slot) {                                                                // One frame per flush so live clients are not held up
+    OTADashLogRecord record;
+    char line[OTA_DASH_LOG_PAYLOAD_MAX + 1];
+    uint32_t lines        = 0;
+    uint32_t lastSequence = 0;
+    bool more             = false;
+
+    uint32_t position = debugLog->first();
+    if (!debugLog->read(position, record, nullptr, 0) || static_cast<int32_t>(slot.replaySequence - record.sequence) >= 0) {
+        slot.logCursor      = debugLog->seek(slot.replaySequence);                                                  // Still in the ring, nothing to replay
+        slot.replaySequence = 0;
+        return;
+    }
+
+    startDebugBatch();
+    while (debugArchive->read(slot.replaySequence, record, line, sizeof(line))) {
+        if (record.level > slot.filter.level || !matchesDebugFilter(slot.filter, line, record.tagLength)) {
+            continue;
+        }
+        lastSequence = record.sequence;
+        lines++;
+        if (!addDebugRecord(record, line, slot.binaryLogs, lines)) {
+            more = true;
+            break;
         }
+    }
+    finishDebugBatch(slot.binaryLogs, lines, lastSequence);
+
+    if (lines > 0) {
+        sendDashFrame(slot.id, slot.binaryLogs, shareDebugBatch(slot.binaryLogs));
+    }
+    if (!more) {                                                                                                    // Archive exhausted, continue from the ring
+        slot.logCursor      = debugLog->seek(slot.replaySequence);
+        slot.replaySequence = 0;
+    }
+}
+#endif
 
-        if (debugLogsCounter >= debugLogsMax) {                                                                         // Clear buffer if it gets too large
-            debugLogs = "";
-            debugLogsCounter = 0;
+DashClient* OTADash::findDashClient(uint32_t id, bool allocate) {                                                     // Caller must hold dashClientsLock
+    DashClient* freeSlot = nullptr;
+    for (DashClient& slot : dashClients) {
+        if (slot.id == id) {
+            return &slot;
+        }
+        if (!freeSlot && slot.id == 0) {
+            freeSlot = &slot;
         }
     }
+
+    if (allocate && freeSlot) {
+        *freeSlot = {};
+        freeSlot->id           = id;
+        freeSlot->filter.level = DEBUG_LEVEL_VERBOSE;
+        return freeSlot;
+    }
+    return nullptr;
+}
+
+void OTADash::setDebugFilter(uint32_t id, int level, const char* include, const char* exclude) {
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+    DashClient* slot = findDashClient(id, false);                                                                   // Slot is created by "resume"
+    if (slot) {
+        fillDebugFilter(slot->filter, level, include, exclude);
+    }
+    xSemaphoreGive(dashClientsLock);
+    OTADASH_LOGGER(debug, "Client %u log filter: level %d, include '%s', exclude '%s'", id, level, include, exclude);
+}
+
+void OTADash::fillDebugFilter(DebugFilter& filter, int level, const char* include, const char* exclude) {
+    memset(&filter, 0, sizeof(filter));                                                                             // Zero padding so filters compare with memcmp
+    filter.level = level < DEBUG_LEVEL_NONE ? DEBUG_LEVEL_NONE : level > DEBUG_LEVEL_VERBOSE ? DEBUG_LEVEL_VERBOSE : level;
+    strncpy(filter.include, include, sizeof(filter.include) - 1);
+    strncpy(filter.exclude, exclude, sizeof(filter.exclude) - 1);
+}
+
+bool OTADash::matchesDebugFilter(const DebugFilter& filter, const char* tag, size_t tagLength) {
+    if (filter.include[0] && !otaDashMatchesTagList(filter.include, tag, tagLength)) {
+        return false;
+    }
+    return !(filter.exclude[0] && otaDashMatchesTagList(filter.exclude, tag, tagLength));
+}
+
+void OTADash::flushEventStream() {                                                                                    // One "log" event per line, the id is its sequence
+    if (!dashClientsLock) {
+        return;
+    }
+
+    OTADashLogRecord record;
+    char payload[OTA_DASH_LOG_PAYLOAD_MAX + 1];
+    char line[OTA_DASH_LOG_PAYLOAD_MAX + 32];
+
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);                                                                 // Held so onDisconnect cannot free a client mid send
+    for (EventClient& slot : eventClients) {
+        if (!slot.client || !slot.client->connected()) {
+            continue;
+        }
+        while (slot.client->packetsWaiting() < OTA_DASH_SSE_QUEUE && debugLog->read(slot.logCursor, record, payload, sizeof(payload))) {
+            size_t length = formatDebugLine(line, sizeof(line), record, payload);
+            if (length > 0 && line[length - 1] == '\n') {
+                line[length - 1] = '\0';
+            }
+            slot.client->send(line, "log", record.sequence);
+        }
+    }
+    xSemaphoreGive(dashClientsLock);
+}
+
+void OTADash::publishMetrics() {
+    uint32_t now = millis();
+    if (now - metricsLastSent < OTA_DASH_METRICS_INTERVAL) {
+        return;
+    }
+    metricsLastSent = now;
+
+    bool listening = events->count() > 0;                                                                           // Skip building the JSON when nobody listens
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+    for (const DashClient& slot : dashClients) {
+        listening |= slot.id != 0 && (dashClientTopics(slot) & (1u << DASH_TOPIC_METRICS));
+    }
+    xSemaphoreGive(dashClientsLock);
+    if (!listening) {
+        return;
+    }
+
+    String metrics = getMetrics();
+    events->send(metrics.c_str(), "metrics");
+    publish("metrics", metrics);
+}
+
+String OTADash::getMetrics() {
+    JsonDocument metrics;
+    metrics["uptime"]         = millis();
+    metrics["freeHeap"]       = ESP.getFreeHeap();
+    metrics["minFreeHeap"]    = ESP.getMinFreeHeap();
+    metrics["rssi"]           = WiFi.RSSI();
+    metrics["wsClients"]      = ws->count();
+    metrics["eventClients"]   = events->count();
+    metrics["logLines"]       = debugLog->count();
+    metrics["logSequence"]    = debugLog->nextSequence() - 1;
+    metrics["linesCollapsed"] = debugLinesCollapsed;
+    metrics["linesDropped"]   = debugLinesDropped;
+    metrics["linesSkipped"]   = wsLinesSkipped;
+
+    String json;
+    serializeJson(metrics, json);
+    return json;
+}
+
+void OTADash::captureDeviceFacts() {                                                                                  // Fixed for the life of the firmware, read once
+    deviceFacts.chipModel       = ESP.getChipModel();
+    deviceFacts.chipCores       = ESP.getChipCores();
+    deviceFacts.chipRevision    = ESP.getChipRevision();
+    deviceFacts.cpuFreqMHz      = ESP.getCpuFreqMHz();
+    deviceFacts.flashSize       = ESP.getFlashChipSize();
+    deviceFacts.flashSpeed      = ESP.getFlashChipSpeed();
+    deviceFacts.sketchSize      = ESP.getSketchSize();                                                              // Walks the app image, too slow to repeat per request
+    deviceFacts.sketchSpace     = ESP.getFreeSketchSpace();
+    deviceFacts.heapSize        = ESP.getHeapSize();
+    deviceFacts.psramSize       = ESP.getPsramSize();
+}
+
+void OTADash::getDeviceInfo(JsonVariant info) {
+    info["product"]         = productName;
+    info["firmware"]        = firmwareVersion;
+    info["version"]         = OTA_DASH_VERSION;
+    info["chipModel"]       = deviceFacts.chipModel;
+    info["chipCores"]       = deviceFacts.chipCores;
+    info["chipRevision"]    = deviceFacts.chipRevision;
+    info["cpuFreqMHz"]      = deviceFacts.cpuFreqMHz;
+    info["flashSize"]       = deviceFacts.flashSize;                                                                // Sizes in bytes, speeds in Hz unless named otherwise
+    info["flashSpeed"]      = deviceFacts.flashSpeed;
+    info["sketchSize"]      = deviceFacts.sketchSize;
+    info["sketchSpace"]     = deviceFacts.sketchSpace;
+    info["heapSize"]        = deviceFacts.heapSize;
+    info["psramSize"]       = deviceFacts.psramSize;
+
+    info["temperature"]     = temperatureRead();
+    info["freeHeap"]        = ESP.getFreeHeap();
+    info["minFreeHeap"]     = ESP.getMinFreeHeap();
+    info["freePsram"]       = deviceFacts.psramSize ? ESP.getFreePsram() : 0;
+    info["apSSID"]          = WiFi.softAPSSID();
+    info["apIP"]            = WiFi.softAPIP().toString();
+    info["apClients"]       = WiFi.softAPgetStationNum();
+    info["connected"]       = isWifiConnected;
+    if (isWifiConnected) {
+        info["ip"]          = WiFi.localIP().toString();
+        info["rssi"]        = WiFi.RSSI();
+    }
+    info["uptime"]          = millis();
+}
+
+void OTADash::serviceDashClients() {                                                                                  // Keepalive and reaping, runs from otaDashTask
+    uint32_t now = millis();
+    if (!dashClientsLock || now - wsLastPing < OTA_DASH_WS_PING_INTERVAL) {
+        return;
+    }
+    wsLastPing = now;
+
+    uint32_t ping[OTA_DASH_WS_MAX_CLIENTS];
+    uint32_t idle[OTA_DASH_WS_MAX_CLIENTS];
+    size_t pingCount = 0;
+    size_t idleCount = 0;
+
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+    for (const DashClient& slot : dashClients) {
+        if (slot.id == 0) {
+            continue;
+        }
+        if (now - slot.lastSeen >= OTA_DASH_WS_IDLE_TIMEOUT) {
+            idle[idleCount++] = slot.id;
+        } else {
+            ping[pingCount++] = slot.id;
+        }
+    }
+    xSemaphoreGive(dashClientsLock);
+
+    for (size_t i = 0; i < idleCount; i++) {                                                                        // By id and outside the lock: AsyncTCP may free a client at any
+        OTADASH_LOGGER(info, "Closing idle WebSocket client ID=%u", idle[i]);                                       // time, and close() may call back into the event handler
+        if (ws->hasClient(idle[i])) {
+            ws->close(idle[i], 1001, "Idle");
+        } else {
+            releaseDashClient(idle[i]);
+        }
+        wsClientsReaped++;
+    }
+    for (size_t i = 0; i < pingCount; i++) {
+        ws->ping(ping[i]);
+    }
+    ws->cleanupClients(OTA_DASH_WS_MAX_CLIENTS);                                                                    // Frees sockets of clients that already went away
+}
+
+void OTADash::touchDashClient(uint32_t id) {
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+    DashClient* slot = findDashClient(id, false);
+    if (slot) {
+        slot->lastSeen = millis();
+    }
+    xSemaphoreGive(dashClientsLock);
+}
+
+bool OTADash::isDashClientBacklogged(AsyncWebSocketClient* client) const {                                           // The queue only reports frames, not bytes
+    return client->queueIsFull() || client->queueLen() >= OTA_DASH_WS_QUEUE_MESSAGES;
+}
+
+/*
+ * Used without dashClientsLock. AsyncTCP may free a client at any time, so like the id based
+ * AsyncWebSocket calls these look it up right before using it and never keep the pointer.
+ */
+bool OTADash::checkDashClient(uint32_t id, bool& backlogged) {                                                      // False once the client is gone
+    AsyncWebSocketClient* client = ws->client(id);
+    if (!client || client->status() != WS_CONNECTED) {
+        return false;
+    }
+    backlogged = isDashClientBacklogged(client);
+    return true;
+}
+
+bool OTADash::sendDashFrame(uint32_t id, bool binary, const AsyncWebSocketSharedBuffer& buffer) {
+    AsyncWebSocketClient* client = ws->client(id);
+    if (!client || client->status() != WS_CONNECTED) {
+        return false;
+    }
+    return binary ? client->binary(buffer) : client->text(buffer);
+}
+
+void OTADash::releaseDashClient(uint32_t id) {
+    if (!dashClientsLock) {
+        return;
+    }
+
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+    DashClient* slot = findDashClient(id, false);
+    if (slot) {
+        *slot = {};
+    }
+    xSemaphoreGive(dashClientsLock);
+}
+
+void OTADash::resumeDebugLogs(uint32_t id, uint32_t sequence, bool binary, int level, const char* include, const char* exclude) {
+    uint32_t cursor = debugLog->seek(sequence);                                                                     // Runs on the AsyncTCP task, the archive is only touched by otaDashTask
+    uint32_t replay = 0;
+
+    #if OTA_DASH_LOG_ARCHIVE
+    replay = sequence > 0 ? sequence : 1;                                                                           // replayDebugArchive() decides if any of it is archived
+    #endif
+
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+    DashClient* slot = findDashClient(id, true);
+    if (slot) {
+        slot->logCursor      = cursor;
+        slot->binaryLogs     = binary;
+        slot->replaySequence = replay;
+        fillDebugFilter(slot->filter, level, include, exclude);                                                     // With the cursor, so no frame mixes old position and new filter
+        slot->topics         = (slot->subscribed ? slot->topics : 0) | (1u << DASH_TOPIC_LOGS);                       // Debug page needs no scan results
+        slot->subscribed     = true;
+    }
+    xSemaphoreGive(dashClientsLock);
+
+    if (slot) {
+        OTADASH_LOGGER(debug, "Client %u resumed debug logs from #%u", id, sequence);
+    } else {
+        OTADASH_LOGGER(warn, "No free debug slot for client %u", id);
+    }
+}
+
+void OTADash::publish(const char* topic, const char* payload, size_t len) {
+    if (!serverStarted || !dashClientsLock) {
+        return;
+    }
+
+    AsyncWebSocketSharedBuffer buffer;                                                                              // Copied once, released after the last client sent it
+
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+    int index = findDashTopic(topic, true);
+    for (DashClient& slot : dashClients) {
+        if (index < 0 || slot.id == 0 || !(dashClientTopics(slot) & (1u << index))) {
+            continue;
+        }
+        AsyncWebSocketClient* client = ws->client(slot.id);
+        if (client && client->status() == WS_CONNECTED && !isDashClientBacklogged(client)) {
+            if (!buffer) {
+                buffer = std::make_shared<std::vector<uint8_t>>(payload, payload + len);
+            }
+            client->text(buffer);
+        }
+    }
+    xSemaphoreGive(dashClientsLock);
+
+    if (index < 0) {
+        OTADASH_LOGGER(warn, "No room for topic '%s'", topic);
+    }
+}
+
+void OTADash::subscribeDashClient(uint32_t id, JsonArrayConst topics) {                                              // Replaces the client's topic set
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+    DashClient* slot = findDashClient(id, true);
+    if (slot) {
+        uint32_t mask = 0;
+        for (JsonVariantConst topic : topics) {
+            int index = findDashTopic(topic | "", false);                                                           // Only names the firmware knows, pages cannot fill the table
+            if (index >= 0) {
+                mask |= 1u << index;
+            }
+        }
+        slot->topics     = mask;
+        slot->subscribed = true;
+    }
+    xSemaphoreGive(dashClientsLock);
+    OTADASH_LOGGER(debug, "Client %u subscribed to %u topics", id, (unsigned)topics.size());
+}
+
+int OTADash::findDashTopic(const char* name, bool create) {                                                           // Caller must hold dashClientsLock
+    if (!name || !*name) {
+        return -1;
+    }
+
+    uint32_t hash = otaDashHash(name, strlen(name));
+    for (uint8_t i = 0; i < dashTopicCount; i++) {
+        if (dashTopics[i] == hash) {
+            return i;
+        }
+    }
+    if (!create || dashTopicCount >= OTA_DASH_WS_MAX_TOPICS) {
+        return -1;
+    }
+    dashTopics[dashTopicCount] = hash;
+    return dashTopicCount++;
+}
+
+uint32_t OTADash::dashClientTopics(const DashClient& slot) {
+    if (slot.subscribed) {
+        return slot.topics;
+    }
+    return (1u << DASH_TOPIC_SCAN) | (1u << DASH_TOPIC_PAIRING);                                                      // What every page received before topics existed
+}
+
+int OTADash::getDebugClientCount() {
+    int count = 0;
+    if (dashClientsLock) {
+        xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+        for (const DashClient& slot : dashClients) {
+            if (slot.id != 0 && (slot.topics & (1u << DASH_TOPIC_LOGS))) {
+                count++;
+            }
+        }
+        xSemaphoreGive(dashClientsLock);
+    }
+    return count;
+}
+
+void OTADash::setDebugLogMax(int logs) {
+    debugLogsMax = logs;
+    debugLog->setMaxRecords(logs > 0 ? logs : 0);
+}
+
+void OTADash::appendDebugHtml(String& out, const char* text, size_t len) {                                            // Escape a raw log line for the debug page
+    size_t start = 0;
+    for (size_t i = 0; i < len; i++) {
+        const char* replacement = nullptr;
+        switch (text[i]) {
+            case '\n': replacement = "<br/>";  break;
+            case '\r': replacement = "";       break;
+            case '\t': replacement = "&emsp;"; break;
+            default: continue;
+        }
+        out.concat(text + start, i - start);
+        out += replacement;
+        start = i + 1;
+    }
+    out.concat(text + start, len - start);
 }
 
 String OTADash::encryptionTypeToString(int encryptionType) {                                                            // Helper function to convert encryption type to a string
@@ -300,77 +1374,76 @@ void OTADash::setupServer() {
     });
 
     server->on("/", HTTP_GET, [this](AsyncWebServerRequest *request){
-        isOnDebugPage = false;
-        String html = index_html;
-        html.replace("%PORTAL_HEADING%", portal_title);
-        html.replace("%CUSTOM_DOMAIN%", customDomain);
-        if(customPages.size() > 0) {
-            String rawName = customPages[0].path;
-
-            if (rawName.startsWith("/")) {
-                rawName = rawName.substring(1);
-            }
+        sendPortal(request);
+    });
 
-            if (rawName.length() > 0) {
-                rawName.setCharAt(0, toupper(rawName.charAt(0)));
+    #if OTA_DASH_SPA
+    server->on("/app", HTTP_GET, [this](AsyncWebServerRequest *request){
+        sendAsset(request, app_html_asset);
+    });
+    #endif
+
+    server->on("/api/portal", HTTP_GET, [this](AsyncWebServerRequest *request){                                    // What the dashboard shell shows around its views
+        JsonDocument portal;
+        portal["title"]   = portal_title;
+        portal["domain"]  = customDomain;
+        portal["version"] = OTA_DASH_VERSION;
+        JsonArray pages   = portal["pages"].to<JsonArray>();
+        for (const CustomPage& page : customPages) {
+            if (!page.htmlContent.isEmpty()) {
+                JsonObject entry  = pages.add<JsonObject>();
+                entry["path"] = page.path;
+                entry["name"] = customPageName(page.path);
             }
+        }
 
-            String displayName = rawName;
+        AsyncResponseStream *response = request->beginResponseStream("application/json", 256);
+        response->addHeader("Cache-Control", "no-cache");
+        serializeJson(portal, *response);
+        request->send(response);
+    });
 
-            html.replace(
-                "%CUSTOM_CONTENT%",
-                "<a href=\"" + customPages[0].path + "\" class=\"button\">" + displayName + "</a>"
-            );
+    server->on("/styles.css", HTTP_GET, [](AsyncWebServerRequest *request){
+        bool versioned = request->hasParam("v") && request->getParam("v")->value() == otadash_css_asset.hash;    // Pages link ?v=<hash>, a new build changes the URL
+        sendAsset(request, otadash_css_asset, versioned ? "public, max-age=" OTA_DASH_ASSET_MAX_AGE ", immutable" : "no-cache");
+    });
 
-        } else {
-            html.replace("%CUSTOM_CONTENT%", "");
+    server->on("/theme.css", HTTP_GET, [this](AsyncWebServerRequest *request){                                     // Colours only, the base stylesheet never changes with them
+        char tag[sizeof(themeTag)];
+        xSemaphoreTake(pageValuesLock, portMAX_DELAY);                                                              // setTheme() swaps both on the caller's task
+        String css = themeCss;
+        memcpy(tag, themeTag, sizeof(tag));
+        xSemaphoreGive(pageValuesLock);
+
+        if (sendNotModified(request, tag, "no-cache")) {
+            return;
         }
-        request->send(200, "text/html", html.c_str());
+        AsyncWebServerResponse *response = request->beginResponse(200, "text/css", css);
+        response->addHeader("ETag", tag);
+        response->addHeader("Cache-Control", "no-cache");
+        request->send(response);
     });
 
-    server->on("/styles.css", HTTP_GET, [](AsyncWebServerRequest *request){
-        request->send(200, "text/css", otadash_css);
+    server->on("/info", HTTP_GET, [this](AsyncWebServerRequest *request){
+        sendAsset(request, device_info_html_asset);                                                                 // Filled in by the page from /api/info
     });
 
-    server->on("/info", HTTP_GET, [this](AsyncWebServerRequest *request){
-        isOnDebugPage = false;
-        String infoHtml = device_info_html;
-        String deviceInfo;
-        deviceInfo =  "<tr><td>Product Name</td><td>"               + productName                                       + "</td></tr>";
-        deviceInfo += "<tr><td>Firmware Version</td><td>"           + firmwareVersion                                   + "</td></tr>";
-        deviceInfo +=  "<tr><td>Chip Model</td><td>"                + String(ESP.getChipModel())                        + "</td></tr>";
-        deviceInfo += "<tr><td>Chip Cores</td><td>"                 + String(ESP.getChipCores())                        + "</td></tr>";
-        deviceInfo += "<tr><td>Chip Revision</td><td>"              + String(ESP.getChipRevision())                     + "</td></tr>";
-        deviceInfo += "<tr><td>CPU Frequency</td><td>"              + String(ESP.getCpuFreqMHz())                       + " MHz</td></tr>";
-        deviceInfo += "<tr><td>Chip Temperature</td><td>"           + String(temperatureRead())                         + " °C</td></tr>";
-
-        deviceInfo += "<tr><td>Access Point SSID</td><td>"          + WiFi.softAPSSID()                                 + "</td></tr>";
-        deviceInfo += "<tr><td>Access Point IP Address</td><td>"    + WiFi.softAPIP().toString()                        + "</td></tr>";
-        deviceInfo += "<tr><td>Connected Clients</td><td>"          + String(WiFi.softAPgetStationNum())                + "</td></tr>";
-
-        deviceInfo += "<tr><td>Flash Size</td><td>"                 + String(ESP.getFlashChipSize() / (1024 * 1024))    + " MB</td></tr>";
-        deviceInfo += "<tr><td>Flash Speed</td><td>"                + String(ESP.getFlashChipSpeed() / 1000000)         + " MHz</td></tr>";
-        deviceInfo += "<tr><td>Sketch Size</td><td>"                + String(ESP.getSketchSize())                       + " bytes</td></tr>";
-        deviceInfo += "<tr><td>Free Sketch Space</td><td>"          + String(ESP.getFreeSketchSpace() / (1024 * 1024))  + " MB</td></tr>";
-        deviceInfo += "<tr><td>Heap Size</td><td>"                  + String(ESP.getHeapSize() / (1024 * 1024))         + " MB</td></tr>";
-        deviceInfo += "<tr><td>Free Heap</td><td>"                  + String(ESP.getFreeHeap() / (1024 * 1024))         + " MB</td></tr>";
-        deviceInfo += "<tr><td>PSRAM Size</td><td>"                 + String(ESP.getPsramSize() / (1024 * 1024))        + " MB</td></tr>";
-        deviceInfo += "<tr><td>Free PSRAM</td><td>"                 + String(ESP.getFreePsram() / (1024 * 1024))        + " MB</td></tr>";
-
-        deviceInfo += "<tr><td>Uptime</td><td>"                     + String(millis() / 1000)                           + " seconds</td></tr>";
-
-        infoHtml.replace("%DEVICE_INFO%", deviceInfo);
-        request->send(200, "text/html", infoHtml.c_str());
+    server->on("/api/info", HTTP_GET, [this](AsyncWebServerRequest *request){
+        JsonDocument info;
+        getDeviceInfo(info.to<JsonVariant>());
+
+        AsyncResponseStream *response = request->beginResponseStream("application/json", 512);
+        response->addHeader("Cache-Control", "no-store");
+        serializeJson(info, *response);
+        request->send(response);
     });
 
     server->on("/about", HTTP_GET, [this](AsyncWebServerRequest *request){
-        isOnDebugPage = false;
-        request->send(200, "text/html", about_html);
+        sendAsset(request, about_html_asset);
     });
 
     server->on("/wifimanage", HTTP_GET, [this](AsyncWebServerRequest *request) {
-        String html = wifi_manage_html;
-        request->send(200, "text/html", html.c_str());
+        sendAsset(request, wifi_manage_html_asset);
         if(currentMode != NetworkMode::ACCESS_POINT && currentMode != NetworkMode::DUAL) {
             OTADASH_LOGGER(warn, "Wi-Fi scan Skipped (Not in AP or Dual mode)");
             vTaskDelay(100 / portTICK_PERIOD_MS);
@@ -419,8 +1492,7 @@ void OTADash::setupServer() {
     });
 
     server->on("/update", HTTP_GET, [this](AsyncWebServerRequest *request){
-        String html = update_firmware_html;
-        request->send(200, "text/html", html.c_str());
+        sendAsset(request, update_firmware_html_asset);
     });
 
     server->on("/update", HTTP_POST, [](AsyncWebServerRequest *request){
@@ -428,8 +1500,7 @@ void OTADash::setupServer() {
     }, handleUpload);
 
     server->on("/erase", HTTP_GET, [this](AsyncWebServerRequest *request){
-        String html = erase_settings_html;
-        request->send(200, "text/html", html.c_str());
+        sendAsset(request, erase_settings_html_asset);
     });
 
     server->on("/erase", HTTP_POST, [this](AsyncWebServerRequest *request){
@@ -441,20 +1512,47 @@ void OTADash::setupServer() {
     });
 
     server->on("/debug", HTTP_GET, [this](AsyncWebServerRequest *request){
-        String html = debug_html;
-        isOnDebugPage = true;
-        html.replace("%PORTAL_HEADING%", portal_title);
-        request->send(200, "text/html", html.c_str());
-        
-        if (debugLogs.length() > 0) {
-            vTaskDelay(100 / portTICK_PERIOD_MS);
-            ws->textAll(debugLogs);
+        sendTemplate(request, debugTemplate);                                                                       // History is replayed once the page sends "resume"
+    });
+
+    #if OTA_DASH_LOG_PERSIST
+    server->on("/logs/download", HTTP_GET, [this](AsyncWebServerRequest *request){
+        if (!persistEnabled) {
+            request->send(404, "text/plain", "Log persistence is not enabled");
+            return;
         }
+
+        auto download     = std::make_shared<LogDownload>();
+        download->last    = persistSegment;
+        download->segment = persistSegment >= persistSegmentCount ? persistSegment - persistSegmentCount + 1 : 0;
+        persistFlushRequested = true;                                                                               // Lines still in the staging block follow on the next write
+
+        AsyncWebServerResponse *response = request->beginChunkedResponse("text/plain", [download](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            while (true) {                                                                                          // Stream segment files oldest first, one chunk at a time
+                if (!download->file) {
+                    if (download->segment > download->last) {
+                        return 0;
+                    }
+                    char path[48];
+                    segmentPath(path, sizeof(path), download->segment++);
+                    download->file = LittleFS.open(path, FILE_READ);
+                    continue;
+                }
+
+                size_t read = download->file.read(buffer, maxLen);
+                if (read > 0) {
+                    return read;
+                }
+                download->file.close();
+            }
+        });
+        response->addHeader("Content-Disposition", "attachment; filename=\"otadash-logs.txt\"");
+        request->send(response);
     });
+    #endif
 
     server->on("/restart", HTTP_GET, [this](AsyncWebServerRequest *request){
-        String html = restart_device_html;
-        request->send(200, "text/html", html.c_str());
+        sendAsset(request, restart_device_html_asset);
     });
 
     server->on("/restart", HTTP_POST, [this](AsyncWebServerRequest *request){
@@ -464,17 +1562,11 @@ void OTADash::setupServer() {
     });
 
     server->on("/generate_204", HTTP_GET, [this](AsyncWebServerRequest *request){
-        String html = index_html;
-        html.replace("%PORTAL_HEADING%", portal_title);
-        html.replace("%CUSTOM_DOMAIN%", customDomain);
-        request->send(200, "text/html", html.c_str());
+        sendPortal(request);
     });
 
     server->on("/fwlink", HTTP_GET, [this](AsyncWebServerRequest *request){
-        String html = index_html;
-        html.replace("%PORTAL_HEADING%", portal_title);
-        html.replace("%CUSTOM_DOMAIN%", customDomain);
-        request->send(200, "text/html", html.c_str());
+        sendPortal(request);
     });
 
     server->on("/pair", HTTP_OPTIONS, [](AsyncWebServerRequest *request){
@@ -593,30 +1685,28 @@ void OTADash::handleUpdate(AsyncWebServerRequest *request) {
     response->addHeader("Connection", "close");
     request->send(response);
 
-    xTaskCreate([](void *param) {
-        vTaskDelay(2000 / portTICK_PERIOD_MS);
-        ESP.restart();
-        vTaskDelete(NULL);
-    }, "ota_restart", 2048, NULL, 1, NULL);
+    scheduleRestart(2000);
 }
 
 void OTADash::handleUpload(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) {
+    OTADashLogTee updateLog(&Serial, "update", DEBUG_LEVEL_ERROR);                                                 // Update errors also reach the debug page
+
     if (!index) {
         OTADASH_LOGGER(info, "Update Start: %s", filename.c_str());
         if (!Update.begin(UPDATE_SIZE_UNKNOWN)) { 
-            Update.printError(Serial);
+            Update.printError(updateLog);
         }
     }
     if (!Update.hasError()) {
         if (Update.write(data, len) != len) {
-            Update.printError(Serial);
+            Update.printError(updateLog);
         }
     }
     if (final) {
         if (Update.end(true)) {
             OTADASH_LOGGER(info, "Update Success: %u B", index + len);
         } else {
-            Update.printError(Serial);
+            Update.printError(updateLog);
         }
     }
 }
@@ -631,7 +1721,7 @@ void OTADash::handlePairingResult() {
         response = "{\"status\":\"error\",\"message\":\"Pairing failed\"}";
     }
     pairRequest = pairResult = false;
-    ws->textAll(response);
+    publish("pairing", response);
 }
 
 void OTADash::otaDashTask(void *parameter) {
@@ -641,6 +1731,16 @@ void OTADash::otaDashTask(void *parameter) {
     
     while(dash->serverStarted) {
         dash->handleClient();
+        dash->serviceDashClients();
+        #if OTA_DASH_LOG_ARCHIVE
+            dash->debugArchive->capture(*dash->debugLog);                                                           // Every 10 ms, long before a quarter of the ring can fill
+        #endif
+        dash->flushDebugLogs();
+        dash->flushEventStream();
+        dash->publishMetrics();
+        #if OTA_DASH_LOG_PERSIST
+            dash->persistDebugLogs(false);
+        #endif
         vTaskDelay(10 / portTICK_PERIOD_MS);
 
         if (!mdnsInitialized && (dash->currentMode == NetworkMode::STATION || dash->currentMode == NetworkMode::DUAL)) {
@@ -695,32 +1795,187 @@ void OTADash::handleWifiScanResult(int scanResult) {
         networks += "]";
         cachedScanResults = networks;
         cachedScanCount = scanResult;
-        ws->textAll(networks);
+        publish("scan", networks);
     }
     scanWiFi = false;
 }
 
 void OTADash::publishCachedScanResults() {
     if (!cachedScanResults.isEmpty()) {
-        ws->textAll(cachedScanResults);
+        publish("scan", cachedScanResults);
         OTADASH_LOGGER(info, "Serving cached Wi-Fi scan results (%d networks)", cachedScanCount >= 0 ? cachedScanCount : 0);
     } else {
-        ws->textAll("[]");
+        publish("scan", "[]", 2);
         OTADASH_LOGGER(info, "No cached Wi-Fi scan results available");
     }
 }
 
-void OTADash::handleWebSocketMessage(void *arg, uint8_t *data, size_t len) {
-    AwsFrameInfo *info = (AwsFrameInfo*)arg;
-    if(info->final && info->index == 0 && info->len == len) {
-        if(info->opcode == WS_TEXT) {
-            String message;
-            for (size_t i = 0; i < len; i++) {
-                message += (char)data[i];
+void OTADash::receiveWebSocketData(AsyncWebSocketClient *client, AwsFrameInfo *info, uint8_t *data, size_t len) {
+    if (info->message_opcode != WS_TEXT) {
+        return;
+    }
+
+    if (info->final && info->num == 0 && info->index == 0 && info->len == len) {                                    // Whole message in one piece, no copy needed
+        handleWebSocketMessage(client, data, len);
+        return;
+    }
+
+    bool complete    = info->final && info->index + len == info->len;
+    bool overflow    = false;
+    uint8_t* message = nullptr;
+    size_t length    = 0;
+
+    xSemaphoreTake(dashClientsLock, portMAX_DELAY);
+    DashClient* slot = findDashClient(client->id(), false);
+    if (slot && dashMessages) {
+        if (info->num == 0 && info->index == 0) {                                                                   // First piece of a new message
+            slot->messageLength   = 0;
+            slot->messageOverflow = false;
+        }
+        if (slot->messageLength + len > OTA_DASH_WS_MESSAGE_MAX) {
+            slot->messageOverflow = true;
+        }
+        if (!slot->messageOverflow) {
+            message = dashMessages.get() + (slot - dashClients) * OTA_DASH_WS_MESSAGE_MAX;
+            memcpy(message + slot->messageLength, data, len);
+            slot->messageLength += len;
+        }
+        if (complete) {
+            overflow = slot->messageOverflow;
+            length   = slot->messageLength;
+            slot->messageLength   = 0;
+            slot->messageOverflow = false;
+        }
+    } else {
+        overflow = complete;                                                                                        // No slot to reassemble into
+    }
+    xSemaphoreGive(dashClientsLock);
+
+    if (!complete) {
+        return;
+    }
+    if (overflow) {
+        wsMessagesDropped++;
+        OTADASH_LOGGER(warn, "Dropped WebSocket message from client %u, larger than %u bytes", client->id(), (unsigned)OTA_DASH_WS_MESSAGE_MAX);
+        #if OTA_DASH_WS_CLOSE_ON_OVERFLOW
+            client->close(1009, "Message too big");
+        #endif
+        return;
+    }
+
+    wsMessagesReassembled++;
+    handleWebSocketMessage(client, message, length);                                                                // Buffer is only touched from the AsyncTCP task
+}
+
+void OTADash::handleWebSocketMessage(AsyncWebSocketClient *client, const uint8_t *data, size_t len) {
+    JsonDocument command;
+    if (!deserializeJson(command, data, len)) {
+        if (!command["cmd"].isNull()) {
+            handleCommand(client, command);
+            return;
+        }
+
+        const char* type = command["type"] | "";
+        switch (otaDashHash(type, strlen(type))) {
+            case otaDashHash("resume"):
+                resumeDebugLogs(client->id(), command["from"].as<uint32_t>(), command["binary"] | false,            // First sequence the client has not seen yet
+                                command["level"] | (int)DEBUG_LEVEL_VERBOSE, command["include"] | "", command["exclude"] | "");
+                return;
+            case otaDashHash("filter"):
+                setDebugFilter(client->id(), command["level"] | (int)DEBUG_LEVEL_VERBOSE, command["include"] | "", command["exclude"] | "");
+                return;
+            case otaDashHash("subscribe"):
+                subscribeDashClient(client->id(), command["topics"].as<JsonArrayConst>());
+                return;
+        }
+    }
+
+    printDebugf("Received message: %.*s", (int)len, reinterpret_cast<const char*>(data));
+}
+
+/*
+ * Request:  {"id": <any>, "cmd": "<name>", "args": <any>}
+ * Reply:    {"id": <same>, "ok": true|false, "result": <any>, "error": "<text>"} sent to the calling client only
+ */
+void OTADash::handleCommand(AsyncWebSocketClient *client, JsonDocument& request) {
+    const char* name      = request["cmd"] | "";
+    uint32_t hash         = otaDashHash(name, strlen(name));
+    JsonVariantConst args = request["args"];
+    JsonDocument reply;
+    JsonVariant result    = reply["result"].to<JsonVariant>();
+    bool ok               = true;
+
+    reply["id"] = request["id"];
+
+    switch (hash) {                                                                                                 // Built in commands, user commands cannot shadow these
+        case otaDashHash("ping"):
+            result["uptime"] = millis();
+            break;
+
+        case otaDashHash("info"):
+            getDeviceInfo(result);
+            break;
+
+        case otaDashHash("scan"):
+            if (currentMode == NetworkMode::ACCESS_POINT || currentMode == NetworkMode::DUAL) {
+                WiFi.scanNetworks(true);
+                scanWiFi = true;                                                                                    // Results are published on the scan topic
+            } else {
+                publishCachedScanResults();
+            }
+            break;
+
+        case otaDashHash("restart"):
+            scheduleRestart(1000);                                                                                  // Leave time for the reply to go out
+            break;
+
+        default: {
+            DashCommandHandler handler;
+            xSemaphoreTake(dashCommandsLock, portMAX_DELAY);
+            for (const DashCommand& entry : dashCommands) {
+                if (entry.hash == hash) {
+                    handler = entry.handler;                                                                        // Copied, so onCommand() can grow the vector meanwhile
+                    break;
+                }
             }
-            printDebug("Received message: " + message);
+            xSemaphoreGive(dashCommandsLock);
+            if (handler) {
+                ok = handler(args, result);
+            } else {
+                ok = false;
+                reply["error"] = "Unknown command";
+                OTADASH_LOGGER(warn, "Unknown command '%s' from client %u", name, client->id());
+            }
+            break;
         }
     }
+
+    reply["ok"] = ok;
+    String text;
+    serializeJson(reply, text);
+    client->text(text);
+}
+
+void OTADash::onCommand(const char* name, DashCommandHandler handler) {
+    uint32_t hash = otaDashHash(name, strlen(name));
+    xSemaphoreTake(dashCommandsLock, portMAX_DELAY);
+    for (DashCommand& command : dashCommands) {
+        if (command.hash == hash) {
+            command.handler = handler;
+            xSemaphoreGive(dashCommandsLock);
+            return;
+        }
+    }
+    dashCommands.push_back({hash, handler});
+    xSemaphoreGive(dashCommandsLock);
+}
+
+void OTADash::scheduleRestart(uint32_t delayMs) {
+    xTaskCreate([](void *param) {
+        vTaskDelay((uint32_t)(uintptr_t)param / portTICK_PERIOD_MS);
+        ESP.restart();
+        vTaskDelete(NULL);
+    }, "ota_restart", 2048, (void*)(uintptr_t)delayMs, 1, NULL);
 }
 
 void OTADash::handleNetworkFailure() {
@@ -751,11 +2006,137 @@ void OTADash::addCustomPage(
     std::function<String(const String&)> postCallback
 ) {
     customPages.emplace_back(path, htmlContent, getCallback, postCallback);
+    updateCustomContent();
     if (serverStarted) {
         setupCustomPageRoutes();
     }
 }
 
+void OTADash::updateCustomContent() {                                                                                 // Link to the first custom page on the index page
+    String content;
+    if (!customPages.empty()) {
+        content = "<a href=\"" + customPages[0].path + "\" class=\"button\">" + customPageName(customPages[0].path) + "</a>";
+    }
+
+    xSemaphoreTake(pageValuesLock, portMAX_DELAY);
+    customContent = std::move(content);
+    xSemaphoreGive(pageValuesLock);
+}
+
+bool OTADash::setTheme(ThemeColor color, const char* value) {
+    if (color >= THEME_COLOR_COUNT || !value || strpbrk(value, ";{}<>\"")) {                                        // Keep the value inside its declaration
+        OTADASH_LOGGER(warn, "Rejected theme colour '%s'", value ? value : "");
+        return false;
+    }
+    themeColors[color] = value;
+    updateThemeCss();
+    return true;
+}
+
+void OTADash::resetTheme() {
+    for (String& color : themeColors) {
+        color = "";
+    }
+    updateThemeCss();
+}
+
+void OTADash::updateThemeCss() {
+    String css = ":root{";
+    for (uint8_t i = 0; i < THEME_COLOR_COUNT; i++) {
+        css += webpages_theme[i].property;
+        css += ':';
+        css += themeColors[i].isEmpty() ? webpages_theme[i].value : themeColors[i].c_str();
+        css += ';';
+    }
+    css += '}';
+
+    char tag[sizeof(themeTag)];
+    snprintf(tag, sizeof(tag), "\"%08x\"", (unsigned int)otaDashHash(css.c_str(), css.length()));
+
+    xSemaphoreTake(pageValuesLock, portMAX_DELAY);                                                                  // Built above, only the swap is locked
+    themeCss = std::move(css);
+    memcpy(themeTag, tag, sizeof(themeTag));
+    xSemaphoreGive(pageValuesLock);
+}
+
+String OTADash::customPageName(const String& path) {                                                                  // "/lights" becomes "Lights"
+    String name = path.startsWith("/") ? path.substring(1) : path;
+    if (name.length() > 0) {
+        name.setCharAt(0, toupper(name.charAt(0)));
+    }
+    return name;
+}
+
+void OTADash::sendPortal(AsyncWebServerRequest *request) {                                                            // Landing page, also answers captive portal probes
+    #if OTA_DASH_SPA
+    sendAsset(request, app_html_asset);
+    #else
+    sendTemplate(request, indexTemplate);
+    #endif
+}
+
+void OTADash::sendTemplate(AsyncWebServerRequest *request, const OTADashTemplate& page) {
+    auto state = std::make_shared<TemplateResponse>();
+    xSemaphoreTake(pageValuesLock, portMAX_DELAY);                                                                  // addCustomPage() may rebuild them on another task
+    state->values[TEMPLATE_PORTAL_HEADING] = portal_title;
+    state->values[TEMPLATE_CUSTOM_DOMAIN]  = customDomain;
+    state->values[TEMPLATE_CUSTOM_CONTENT] = customContent;
+    xSemaphoreGive(pageValuesLock);
+
+    uint32_t hash = page.sourceHash();                                                                              // Pages only change with their slot values
+    for (const String& value : state->values) {
+        hash = otaDashHash(value.c_str(), value.length() + 1, hash);                                                // Terminators keep adjacent values apart
+    }
+
+    char etag[12];
+    snprintf(etag, sizeof(etag), "\"%08x\"", (unsigned int)hash);
+    if (sendNotModified(request, etag, "no-cache")) {
+        return;
+    }
+
+    AsyncWebServerResponse *response = request->beginChunkedResponse("text/html", [&page, state](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        TemplateValue values[TEMPLATE_SLOT_COUNT];
+        for (size_t slot = 0; slot < TEMPLATE_SLOT_COUNT; slot++) {
+            values[slot] = { state->values[slot].c_str(), state->values[slot].length() };
+        }
+        return page.render(buffer, maxLen, state->cursor, values);
+    });
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
+
+void OTADash::sendAsset(AsyncWebServerRequest *request, const OTADashAsset& asset, const char* cacheControl) {
+    char etag[16];
+    snprintf(etag, sizeof(etag), "\"%s\"", asset.hash);
+    if (sendNotModified(request, etag, cacheControl)) {
+        return;
+    }
+
+    AsyncWebServerResponse *response = request->beginResponse(200, asset.type, asset.data, asset.length);          // Straight from flash
+    if (asset.encoding) {
+        response->addHeader("Content-Encoding", asset.encoding);                                                    // One copy in flash, every browser accepts gzip
+    }
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", cacheControl);
+    request->send(response);
+}
+
+bool OTADash::sendNotModified(AsyncWebServerRequest *request, const char* etag, const char* cacheControl) {
+    if (!request->hasHeader("If-None-Match")) {
+        return false;
+    }
+    const String& match = request->header("If-None-Match");                                                         // Weak comparison, a W/ prefix still matches
+    if (match != "*" && match.indexOf(etag) < 0) {
+        return false;
+    }
+    AsyncWebServerResponse *response = request->beginResponse(304);
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", cacheControl);
+    request->send(response);
+    return true;
+}
+
 void OTADash::addCustomDataHandler(
     const String& path,
     std::function<String(const String&)> getCallback,
@@ -844,7 +2225,8 @@ String OTADash::queryParamsToJson(AsyncWebServerRequest *request) {
 }
 
 void OTADash::handleCustomPageGet(AsyncWebServerRequest *request, const CustomPage& page) {
-    request->send(200, "text/html", page.htmlContent.c_str());
+    AsyncWebServerResponse *response = request->beginResponse(200, "text/html", (const uint8_t*)page.htmlContent.c_str(), page.htmlContent.length());    // Read from the route's own copy of the page
+    request->send(response);
 }
 
 void OTADash::handleCustomDataGet(AsyncWebServerRequest *request, const CustomPage& page) {
@@ -47,8 +47,19 @@
 #include <EEPROM.h>
 #include <ESPmDNS.h>
 #include <functional>
+#include <esp_log.h>
 #include "ArduinoJson.h"
 #include "OTADashConfig.h"
+#include "OTADashLog.h"
+#include "OTADashTemplate.h"
+
+#ifndef OTA_DASH_LOG_PERSIST
+    #define OTA_DASH_LOG_PERSIST 0
+#endif
+
+#if OTA_DASH_LOG_PERSIST
+    #include <LittleFS.h>
+#endif
 
 #define OTA_DASH_VERSION "1.1.0"
 
@@ -82,17 +93,127 @@
 
 
 #ifndef OTA_DASH_TASK_CORE
-    #define OTA_DASH_TASK_CORE 1
+    #define OTA_DASH_TASK_CORE 0                                                                                    // Core otaDashTask is pinned to
 #endif
 
 #ifndef OTA_DASH_TASK_PRIORITY
-    #define OTA_DASH_TASK_PRIORITY 5
+    #define OTA_DASH_TASK_PRIORITY 1                                                                                // Same as loop(), flushing logs never needs to preempt it
 #endif
 
 #ifndef OTA_DASH_TASK_STACK_SIZE
-    #define OTA_DASH_TASK_STACK_SIZE 4096
+    #if OTA_DASH_LOG_PERSIST
+        #define OTA_DASH_TASK_STACK_SIZE 8192                                                                       // Segment payload and line buffers, snprintf and LittleFS calls
+    #else
+        #define OTA_DASH_TASK_STACK_SIZE 6144                                                                       // Client snapshot in flushDebugLogs() is about 1 KB with 8 clients
+    #endif
+#endif
+
+#ifndef OTA_DASH_WS_MAX_CLIENTS
+    #define OTA_DASH_WS_MAX_CLIENTS 8
+#endif
+
+#ifndef OTA_DASH_WS_PING_INTERVAL
+    #define OTA_DASH_WS_PING_INTERVAL 15000
+#endif
+
+#ifndef OTA_DASH_WS_IDLE_TIMEOUT
+    #define OTA_DASH_WS_IDLE_TIMEOUT 45000                                                                          // Close clients silent for this long, pongs count
 #endif
 
+#ifndef OTA_DASH_WS_QUEUE_MESSAGES
+    #define OTA_DASH_WS_QUEUE_MESSAGES 4                                                                            // Outbound frames queued per client before it counts as slow
+#endif
+
+#ifndef OTA_DASH_SSE_MAX_CLIENTS
+    #define OTA_DASH_SSE_MAX_CLIENTS 4                                                                              // Read only /events watchers, separate from /ws slots
+#endif
+
+#ifndef OTA_DASH_SSE_QUEUE
+    #define OTA_DASH_SSE_QUEUE 8                                                                                    // Stop feeding a watcher with this many packets waiting
+#endif
+
+#ifndef OTA_DASH_METRICS_INTERVAL
+    #define OTA_DASH_METRICS_INTERVAL 5000
+#endif
+
+#ifndef OTA_DASH_GZIP_ASSETS
+    #define OTA_DASH_GZIP_ASSETS 1                                                                                  // Store static pages gzip compressed, 0 stores minified text instead
+#endif
+
+#ifndef OTA_DASH_SPA
+    #define OTA_DASH_SPA 0                                                                                          // 1 serves the single page dashboard shell at / instead of the separate pages
+#endif
+
+#ifndef OTA_DASH_ASSET_MAX_AGE
+    #define OTA_DASH_ASSET_MAX_AGE "31536000"                                                                       // Seconds a versioned /styles.css?v= may be cached
+#endif
+
+#ifndef OTA_DASH_WS_MESSAGE_MAX
+    #define OTA_DASH_WS_MESSAGE_MAX 1024                                                                            // Reassembly buffer per client
+#endif
+
+#ifndef OTA_DASH_WS_CLOSE_ON_OVERFLOW
+    #define OTA_DASH_WS_CLOSE_ON_OVERFLOW 0                                                                         // 0 drops oversized messages, 1 also closes the client
+#endif
+
+#ifndef OTA_DASH_WS_MAX_TOPICS
+    #define OTA_DASH_WS_MAX_TOPICS 16                                                                               // Built in topics included, at most 32
+#endif
+
+static_assert(OTA_DASH_WS_MAX_TOPICS <= 32, "Topic subscriptions are stored as a 32 bit mask");
+
+#define OTA_DASH_LOG_FRAME_VERSION 2                                                                                // First byte of binary log frames
+
+#ifndef OTA_DASH_LOG_FILTER_MAX
+    #define OTA_DASH_LOG_FILTER_MAX 48
+#endif
+
+#ifndef OTA_DASH_LOG_PERSIST_DIR
+    #define OTA_DASH_LOG_PERSIST_DIR "/otadash"
+#endif
+
+#ifndef OTA_DASH_LOG_PERSIST_BLOCK
+    #define OTA_DASH_LOG_PERSIST_BLOCK 4096                                                                         // One flash sector per write
+#endif
+
+#ifndef OTA_DASH_LOG_PERSIST_INTERVAL
+    #define OTA_DASH_LOG_PERSIST_INTERVAL 30000                                                                     // Write a partial block early after this long
+#endif
+
+#ifndef OTA_DASH_LOG_SEGMENT_SIZE
+    #define OTA_DASH_LOG_SEGMENT_SIZE 65536
+#endif
+
+#ifndef OTA_DASH_LOG_SEGMENT_COUNT
+    #define OTA_DASH_LOG_SEGMENT_COUNT 4
+#endif
+
+#ifndef OTA_DASH_LOG_REPEAT_WINDOW
+    #define OTA_DASH_LOG_REPEAT_WINDOW 5000                                                                         // Report collapsed duplicates at least this often
+#endif
+
+#ifndef OTA_DASH_LOG_RATE_LIMIT
+    #define OTA_DASH_LOG_RATE_LIMIT 0                                                                               // Lines per second per tag, 0 disables
+#endif
+
+#ifndef OTA_DASH_LOG_RATE_BURST
+    #define OTA_DASH_LOG_RATE_BURST 20
+#endif
+
+#ifndef OTA_DASH_LOG_RATE_SOURCES
+    #define OTA_DASH_LOG_RATE_SOURCES 8
+#endif
+
+#ifndef OTA_DASH_LOG_FLUSH_INTERVAL
+    #define OTA_DASH_LOG_FLUSH_INTERVAL 100
+#endif
+
+#ifndef OTA_DASH_LOG_FLUSH_BYTES
+    #define OTA_DASH_LOG_FLUSH_BYTES 1024
+#endif
+
+struct OTADashAsset;                                                                                                // Generated into WebAssets.h by tools/build_assets.py
+
 enum NetworkMode {
     ACCESS_POINT,
     STATION,
@@ -100,6 +221,36 @@ enum NetworkMode {
     DUAL
 };
 
+enum DashTopic : uint8_t {                                                                                          // Bit positions of the built in /ws topics
+    DASH_TOPIC_LOGS,
+    DASH_TOPIC_SCAN,
+    DASH_TOPIC_PAIRING,
+    DASH_TOPIC_METRICS,
+    DASH_TOPIC_BUILTIN_COUNT
+};
+
+enum ThemeColor : uint8_t {                                                                                         // Colours setTheme() can change, defaults are the WEBPAGES_*_COLOR macros
+    THEME_TEXT,
+    THEME_PRIMARY,
+    THEME_ACCENT,
+    THEME_ACCENT_1,
+    THEME_BACKGROUND,
+    THEME_BACKGROUND_2,
+    THEME_BACKGROUND_3,
+    THEME_BACKGROUND_4,
+    THEME_BUTTON,
+    THEME_BUTTON_TEXT,
+    THEME_BORDER,
+    THEME_HEADER_FOOTER,
+    THEME_LINK,
+    THEME_DANGER,
+    THEME_WARNING,
+    THEME_BUTTON_HOVER,
+    THEME_DANGER_HOVER,
+    THEME_WARNING_HOVER,
+    THEME_COLOR_COUNT
+};
+
 struct NetworkCredentials {
     char ssid[20];
     char password[20];
@@ -119,7 +270,77 @@ struct CustomPage {
     ) : path(p), htmlContent(html), getCallback(get), postCallback(post) {}
 };
 
+struct DebugFilter {
+    uint8_t  level;                                                                                                 // Least severe level still sent
+    char     include[OTA_DASH_LOG_FILTER_MAX];                                                                      // Comma separated tags, empty sends all
+    char     exclude[OTA_DASH_LOG_FILTER_MAX];
+};
+
+struct DebugRateSource {                                                                                            // Token bucket for one log tag
+    bool     active;
+    uint32_t tagHash;
+    uint32_t tokens;                                                                                                // In thousandths of a line
+    uint32_t lastRefill;
+    uint32_t dropped;                                                                                               // Since the last report
+};
+
+using DashCommandHandler = std::function<bool(JsonVariantConst args, JsonVariant result)>;                           // Return false to reply with "ok": false
+
+struct DashCommand {
+    uint32_t           hash;                                                                                        // otaDashHash of the command name
+    DashCommandHandler handler;
+};
+
+struct DeviceFacts {                                                                                                // Captured once in begin(), served by /api/info
+    const char* chipModel;
+    uint8_t     chipCores;
+    uint8_t     chipRevision;
+    uint32_t    cpuFreqMHz;
+    uint32_t    flashSize;
+    uint32_t    flashSpeed;
+    uint32_t    sketchSize;
+    uint32_t    sketchSpace;
+    uint32_t    heapSize;
+    uint32_t    psramSize;
+};
+
+struct EventClient {                                                                                                // One /events watcher
+    AsyncEventSourceClient* client;                                                                                 // Null when the slot is free
+    uint32_t                logCursor;
+};
+
+struct DashClient {
+    uint32_t    id;                                                                                                 // WebSocket client id, 0 when the slot is free
+    uint32_t    logCursor;                                                                                          // Next log buffer position to send
+    bool        binaryLogs;                                                                                         // Client asked for WS_BINARY log frames
+    uint32_t    replaySequence;                                                                                     // Next archived sequence to replay, 0 when live
+    uint32_t    topics;                                                                                             // Bit per DashTopic or registered topic
+    bool        subscribed;                                                                                         // False until the client picks its topics
+    bool        messageOverflow;                                                                                    // Current message is being discarded
+    size_t      messageLength;                                                                                      // Bytes reassembled so far
+    uint32_t    lastSeen;                                                                                           // millis() of the last frame or pong
+    DebugFilter filter;
+};
+
+class OTADashLogTee : public Print {                                                                                // Forwards to output and copies complete lines into the debug log
+public:
+    OTADashLogTee(Print* output, const char* tag, DebugLevel level) : output(output), tag(tag), level(level) {}
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+private:
+    Print*                                              output;
+    const char*                                         tag;
+    DebugLevel                                          level;
+    OTADashLogLine                                      pending;                                                          // Line collected until '\n'
+    portMUX_TYPE                                        lock                    = portMUX_INITIALIZER_UNLOCKED;
+};
+
 class OTADash {
+    friend class OTADashLogTee;
+
 public:
     OTADash(const char* ssid, const char* password, const char* custom_domain, const char* portal_title);
     ~OTADash();
@@ -127,12 +348,29 @@ public:
     OTADash(const OTADash&) = delete;                                                                               // Prevent copy constructor and assignment
     OTADash& operator=(const OTADash&) = delete;
      
-    OTADash(OTADash&&) noexcept = default;                                                                          // Allow move constructor and assignment
-    OTADash& operator=(OTADash&&) noexcept = default;
+    OTADash(OTADash&&) = delete;                                                                                    // The locks, otaDashTask and the handlers all belong to this object
+    OTADash& operator=(OTADash&&) = delete;
     
-    void printDebug(const String& message);   
+    void printDebug(const char* message, DebugLevel level = DEBUG_LEVEL_INFO);
+    void printDebug(const String& message, DebugLevel level = DEBUG_LEVEL_INFO);   
+    void printDebug(const Printable& value, DebugLevel level = DEBUG_LEVEL_INFO);
+    void printDebugf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    void printDebugf(DebugLevel level, const char* format, ...) __attribute__((format(printf, 3, 4)));
+    void printDebugTag(DebugLevel level, const char* tag, const char* format, ...) __attribute__((format(printf, 4, 5)));
     void begin(NetworkMode mode = NetworkMode::AUTO); 
+    void captureEspLogs(bool enable = true);                                                                        // Copy ESP-IDF esp_log output into the debug log
+    Print& debugSerial()                    { return serialTee;                }                                    // Prints to Serial and the debug log
     
+    #if OTA_DASH_LOG_PERSIST
+    bool enableDebugLogPersistence(size_t segmentSize = OTA_DASH_LOG_SEGMENT_SIZE, uint8_t segmentCount = OTA_DASH_LOG_SEGMENT_COUNT);
+    #endif
+
+    void publish(const char* topic, const char* payload, size_t len);
+    void publish(const char* topic, const String& payload)      { publish(topic, payload.c_str(), payload.length()); }
+
+    void onCommand(const char* name, DashCommandHandler handler);                                                   // Runs on the AsyncTCP task, keep it short
+    bool setTheme(ThemeColor color, const char* value);                                                             // Any CSS colour, served from /theme.css
+    void resetTheme();
     void onPaired(std::function<void(JsonDocument&)> callback);
     void onWifiSaved(std::function<void(const String&, const String&)> callback);
     
@@ -148,7 +386,11 @@ public:
         std::function<String(const String&)> postCallback = nullptr
     );
     
-    void setDebugLogMax(int logs)           { debugLogsMax          = logs;    }
+    void setDebugLogMax(int logs);
+    void setDebugLogBufferSize(size_t size) { debugLogBufferSize    = size;    }
+    void setDebugFlushBytes(size_t bytes)   { debugFlushBytes       = bytes;   }
+    void setDebugFlushInterval(uint32_t ms) { debugFlushInterval    = ms;      }
+    void setDebugRateLimit(uint16_t linesPerSecond, uint16_t burst = OTA_DASH_LOG_RATE_BURST);
     void setEEPROMSize(size_t size)         { eepromSize            = size;    }
     void setPairResult(bool result)         { pairResult            = result;  }
     void setProductName(String name)        { productName           = name;    }
@@ -159,8 +401,18 @@ public:
     void setFirmwareVersion(String version) { firmwareVersion       = version; }
 
     int getEEPROMAddress()    const         { return eepromAddress;            }
-    int getDebugLogsCounter() const         { return debugLogsCounter;         }
+    int getDebugLogsCounter() const         { return debugLog->count();        }
     int getDebugLogsMax()     const         { return debugLogsMax;             }
+    int getDebugClientCount();                                                                                      // Clients currently streaming logs
+    String getMetrics();                                                                                            // JSON sent as the metrics event and topic
+    void getDeviceInfo(JsonVariant info);                                                                           // Same fields as /api/info
+    uint32_t getDebugLinesCoalesced() const { return debugLinesCoalesced;      }
+    uint32_t getDebugLinesCollapsed() const { return debugLinesCollapsed;      }
+    uint32_t getDebugLinesDropped()   const { return debugLinesDropped;        }
+    uint32_t getWsMessagesReassembled() const { return wsMessagesReassembled;  }
+    uint32_t getWsMessagesDropped()   const { return wsMessagesDropped;        }
+    uint32_t getWsLinesSkipped()      const { return wsLinesSkipped;           }
+    uint32_t getWsClientsReaped()     const { return wsClientsReaped;          }
     bool isConnected()        const         { return isWifiConnected;          }
     size_t getEEPROMSize()    const         { return eepromSize;               }
     String getSSID()          const         { return WiFi.SSID();              }
@@ -174,26 +426,67 @@ public:
 
 private:      
     int                                                 eepromAddress           = 0; 
-    int                                                 debugLogsCounter        = 0;
     int                                                 debugLogsMax            = 200;
     int                                                 maxReconnectAttempts    = 3;
     int                                                 cachedScanCount         = -1;
     int                                                 visibleNetworksCount    = -1;
     bool                                                isWifiConnected         = false;
     bool                                                serverStarted           = false;
-    bool                                                isOnDebugPage           = false;
     bool                                                autoReconnect           = true;
     bool                                                pairRequest             = false;
     bool                                                pairResult              = false;
     bool                                                mdnsStarted             = false;
     bool                                                scanWiFi                = false;
     size_t                                              eepromSize              = 50; 
-    String                                              debugLogs;
+    size_t                                              debugLogBufferSize      = OTA_DASH_LOG_BUFFER_SIZE;
+    size_t                                              debugFlushBytes         = OTA_DASH_LOG_FLUSH_BYTES;
     String                                              customDomain;
     String                                              firmwareVersion         = "Not Configured";
     String                                              productName             = "ESP32 Device";
     String                                              cachedScanResults;
+    String                                              customContent;                                                    // %CUSTOM_CONTENT%, rebuilt when pages are added
+    DeviceFacts                                         deviceFacts             = {};
+    String                                              themeColors[THEME_COLOR_COUNT];                                   // Empty means the compile time default
+    String                                              themeCss;                                                         // Rebuilt by setTheme(), small enough to copy per request
+    char                                                themeTag[12]            = {};                                     // ETag of themeCss
+    String                                              debugLogBatch;                                                    // Reused frame buffer for coalesced log lines
+    std::vector<uint8_t>                                debugLogFrame;                                                    // Reused frame buffer for binary log records
     uint32_t                                            reconnectDelay          = 5000;   
+    uint32_t                                            debugFlushInterval      = OTA_DASH_LOG_FLUSH_INTERVAL;
+    uint32_t                                            debugLastFlush          = 0;
+    uint32_t                                            debugLinesCoalesced     = 0;
+    uint32_t                                            debugLinesCollapsed     = 0;
+    uint32_t                                            debugLinesDropped       = 0;
+    uint32_t                                            wsMessagesReassembled   = 0;
+    uint32_t                                            wsMessagesDropped       = 0;
+    uint32_t                                            wsLinesSkipped          = 0;                                // Log lines a slow client never got
+    uint32_t                                            wsClientsReaped         = 0;
+    uint32_t                                            wsLastPing              = 0;
+    uint32_t                                            metricsLastSent         = 0;
+    uint32_t                                            debugLastHash           = 0;
+    size_t                                              debugLastLength         = SIZE_MAX;                           // Length of debugLastLine, SIZE_MAX when nothing can repeat
+    char                                                debugLastLine[OTA_DASH_LOG_LINE_MAX];                         // Last kept line, compared in full before collapsing
+    uint32_t                                            debugRepeatCount        = 0;
+    uint32_t                                            debugRepeatSince        = 0;
+    uint8_t                                             debugRepeatLevel        = DEBUG_LEVEL_INFO;
+    char                                                debugRepeatTag[OTA_DASH_LOG_TAG_MAX + 1] = {};
+    uint16_t                                            debugRateLimit          = OTA_DASH_LOG_RATE_LIMIT;
+    uint16_t                                            debugRateBurst          = OTA_DASH_LOG_RATE_BURST;
+    DebugRateSource                                     debugRateSources[OTA_DASH_LOG_RATE_SOURCES] = {};
+    portMUX_TYPE                                        debugGateLock           = portMUX_INITIALIZER_UNLOCKED;       // Guards duplicate and rate limit state
+    #if OTA_DASH_LOG_PERSIST
+    bool                                                persistEnabled          = false;
+    volatile bool                                       persistFlushRequested   = false;
+    size_t                                              persistUsed             = 0;
+    size_t                                              persistWritten          = 0;                                  // Bytes of persistBuffer already on flash
+    size_t                                              persistBlockOffset      = 0;                                  // File offset of the block in persistBuffer
+    size_t                                              persistSegmentSize      = OTA_DASH_LOG_SEGMENT_SIZE;
+    uint8_t                                             persistSegmentCount     = OTA_DASH_LOG_SEGMENT_COUNT;
+    uint32_t                                            persistSegment          = 0;
+    uint32_t                                            persistCursor           = 0;
+    uint32_t                                            persistLastWrite        = 0;
+    std::unique_ptr<uint8_t[]>                          persistBuffer;                                                    // Staging block written as one sector
+    #endif
     const char*                                         ssid;
     const char*                                         password;
     const char*                                         portal_title;
@@ -201,18 +494,37 @@ private:
     static OTADash*                                     instance;
     static const byte                                   DNS_PORT                = 53;
     NetworkCredentials                                  networkCredentials;
+    OTADashLogTee                                       serialTee               {&Serial, "serial", DEBUG_LEVEL_INFO};
+    static vprintf_like_t                               previousVprintf;                                                  // esp_log output before captureEspLogs()
+    DashClient                                          dashClients[OTA_DASH_WS_MAX_CLIENTS] = {};
+    std::unique_ptr<uint8_t[]>                          dashMessages;                                                     // OTA_DASH_WS_MESSAGE_MAX bytes per client slot
+    EventClient                                         eventClients[OTA_DASH_SSE_MAX_CLIENTS] = {};
+    uint32_t                                            dashTopics[OTA_DASH_WS_MAX_TOPICS] = {                                // Topic name hashes, index is the subscription bit
+        otaDashHash("logs", 4), otaDashHash("scan", 4), otaDashHash("pairing", 7), otaDashHash("metrics", 7)
+    };
+    uint8_t                                             dashTopicCount          = DASH_TOPIC_BUILTIN_COUNT;
+    SemaphoreHandle_t                                   dashClientsLock         = nullptr;
+    SemaphoreHandle_t                                   dashCommandsLock        = nullptr;                            // Guards dashCommands against onCommand() while /ws dispatches
+    SemaphoreHandle_t                                   pageValuesLock          = nullptr;                            // Guards customContent and themeCss/themeTag while a response copies them
     std::unique_ptr<DNSServer>                          dnsServer;
     std::unique_ptr<AsyncWebServer>                     server;
     std::unique_ptr<AsyncWebSocket>                     ws;
+    std::unique_ptr<AsyncEventSource>                   events;
+    std::unique_ptr<OTADashLogBuffer>                   debugLog;                                                         // Preallocated wireless debug history
+    #if OTA_DASH_LOG_ARCHIVE
+    std::unique_ptr<OTADashLogArchive>                  debugArchive;                                                     // Compressed history older than debugLog
+    #endif
     std::function<void(JsonDocument&)>                  pairingCallback;                                                  // User-defined callback
     std::function<void(const String&, const String&)>   wifiSavedCallback;                                                // User-defined callback
     std::vector<CustomPage>                             customPages;                                                      // Store custom pages
+    std::vector<DashCommand>                            dashCommands;                                                     // User registered /ws commands
 
     void stop();
     bool readEEPROM();
     bool writeEEPROM();
     void setupServer();
     void handleClient();   
+    void flushDebugLogs();
     bool startStation();
     void reconnectWifi();
     bool startDualMode(); 
@@ -224,12 +536,60 @@ private:
     void handleWifiScanResult(int scanResult); 
     void publishCachedScanResults();
     String encryptionTypeToString(int encryptionType); 
+    static void appendDebugHtml(String& out, const char* text, size_t len);
     static void handleUpdate(AsyncWebServerRequest *request);
-    void handleWebSocketMessage(void *arg, uint8_t *data, size_t len);
+    uint32_t buildDebugBatch(uint32_t& cursor, bool binary, const DebugFilter& filter);
+    void startDebugBatch();
+    AsyncWebSocketSharedBuffer shareDebugBatch(bool binary);
+    bool addDebugRecord(const OTADashLogRecord& record, const char* line, bool binary, uint32_t lines);
+    void finishDebugBatch(bool binary, uint32_t lines, uint32_t lastSequence);
+    #if OTA_DASH_LOG_ARCHIVE
+    void replayDebugArchive(DashClient& slot);
+    #endif
+    void appendDebugLog(DebugLevel level, const char* tag, const char* text, size_t len);
+    void flushDebugRepeats(bool force);
+    static int captureEspLog(const char* format, va_list args);
+    static size_t formatDebugLine(char* out, size_t size, const OTADashLogRecord& record, const char* payload);
+    #if OTA_DASH_LOG_PERSIST
+    void persistDebugLogs(bool force);
+    void writePersistBlock();
+    void nextPersistSegment();
+    static void segmentPath(char* out, size_t size, uint32_t segment);
+    #endif
+    bool takeDebugToken(uint32_t tagHash, uint32_t now, uint32_t& suppressed);
+    void vprintDebugf(DebugLevel level, const char* tag, const char* format, va_list args);
+    void setDebugFilter(uint32_t id, int level, const char* include, const char* exclude);
+    static void fillDebugFilter(DebugFilter& filter, int level, const char* include, const char* exclude);
+    static bool matchesDebugFilter(const DebugFilter& filter, const char* tag, size_t tagLength);
+    void releaseDashClient(uint32_t id);
+    void flushEventStream();
+    void publishMetrics();
+    void captureDeviceFacts();
+    void serviceDashClients();
+    void touchDashClient(uint32_t id);
+    bool isDashClientBacklogged(AsyncWebSocketClient* client) const;
+    bool checkDashClient(uint32_t id, bool& backlogged);
+    bool sendDashFrame(uint32_t id, bool binary, const AsyncWebSocketSharedBuffer& buffer);
+    DashClient* findDashClient(uint32_t id, bool allocate);
+    void resumeDebugLogs(uint32_t id, uint32_t sequence, bool binary, int level, const char* include, const char* exclude);
+    void subscribeDashClient(uint32_t id, JsonArrayConst topics);
+    int findDashTopic(const char* name, bool create);
+    static uint32_t dashClientTopics(const DashClient& slot);
+    void receiveWebSocketData(AsyncWebSocketClient *client, AwsFrameInfo *info, uint8_t *data, size_t len);
+    void handleWebSocketMessage(AsyncWebSocketClient *client, const uint8_t *data, size_t len);
+    void handleCommand(AsyncWebSocketClient *client, JsonDocument& request);
+    static void scheduleRestart(uint32_t delayMs);
     bool connectToWifi(const char* ssid, const char* password, uint32_t timeout_ms = 20000);
     static void handleUpload(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final);
     
     void setupCustomPageRoutes();
+    void updateCustomContent();
+    void updateThemeCss();
+    static String customPageName(const String& path);
+    void sendPortal(AsyncWebServerRequest *request);
+    void sendTemplate(AsyncWebServerRequest *request, const OTADashTemplate& page);
+    static void sendAsset(AsyncWebServerRequest *request, const OTADashAsset& asset, const char* cacheControl = "no-cache");
+    static bool sendNotModified(AsyncWebServerRequest *request, const char* etag, const char* cacheControl);
     String queryParamsToJson(AsyncWebServerRequest *request);
     void handleCustomPageGet(AsyncWebServerRequest *request, const CustomPage& page);
     void handleCustomDataGet(AsyncWebServerRequest *request, const CustomPage& page);
@@ -10,11 +10,43 @@
 #endif
 
 // Task configuration
-// #define OTA_DASH_TASK_CORE 1
-// #define OTA_DASH_TASK_PRIORITY 5
-// #define OTA_DASH_TASK_STACK_SIZE 4096
+// #define OTA_DASH_TASK_CORE 0
+// #define OTA_DASH_TASK_PRIORITY 1
+// #define OTA_DASH_TASK_STACK_SIZE 8192
 
-// Custom Theme Overrides
+// WebSocket clients and incoming message reassembly
+// #define OTA_DASH_WS_MAX_CLIENTS 8
+// #define OTA_DASH_WS_MESSAGE_MAX 1024
+// #define OTA_DASH_WS_CLOSE_ON_OVERFLOW 1
+// #define OTA_DASH_WS_PING_INTERVAL 15000
+// #define OTA_DASH_WS_IDLE_TIMEOUT 45000
+// #define OTA_DASH_WS_QUEUE_MESSAGES 4
+
+// Wireless debug log storage
+// #define OTA_DASH_LOG_BUFFER_SIZE 8192
+// #define OTA_DASH_LOG_LINE_MAX 256
+// #define OTA_DASH_LOG_FLUSH_INTERVAL 100
+// #define OTA_DASH_LOG_FLUSH_BYTES 1024
+// #define OTA_DASH_LOG_REPEAT_WINDOW 5000
+// #define OTA_DASH_LOG_RATE_LIMIT 10
+// #define OTA_DASH_LOG_RATE_BURST 20
+
+// Keep compressed debug history behind the ring buffer for replay
+// #define OTA_DASH_LOG_ARCHIVE 1
+// #define OTA_DASH_LOG_ARCHIVE_SIZE 16384
+
+// Persist debug logs to LittleFS (call enableDebugLogPersistence() after begin())
+// #define OTA_DASH_LOG_PERSIST 1
+// #define OTA_DASH_LOG_SEGMENT_SIZE 65536
+// #define OTA_DASH_LOG_SEGMENT_COUNT 4
+
+// Serve the single page dashboard shell at / (one cached page, one WebSocket across all views)
+// #define OTA_DASH_SPA 1
+
+// Serve static pages gzip precompressed (rerun tools/build_assets.py after editing "web pages/")
+// #define OTA_DASH_GZIP_ASSETS 0
+
+// Default theme colours (setTheme() changes them at runtime without a rebuild)
 // #define WEBPAGES_TEXT_COLOR             "#ffffff"
 // #define WEBPAGES_ACCENT_COLOR           "#ffffff"
 // #define WEBPAGES_PRIMARY_COLOR          "#ffffff"
@@ -0,0 +1,699 @@
+/*
+ ====================================================================================================
+ * File:        OTADashLog.cpp
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.1.0
+ * Date:        Oct 17 2026
+ * Brief:       Fixed Capacity Ring Buffer Used To Store Wireless Debug Logs
+ *
+ ====================================================================================================
+ * License:
+ * MIT License
+ *
+ * Copyright (c) 2025 Hamas Saeed
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * For any inquiries, contact Hamas Saeed at hamasaeed@gmail.com
+ *
+ ====================================================================================================
+ */
+
+#include "OTADashLog.h"
+
+OTADashLogBuffer::~OTADashLogBuffer() {
+    end();
+}
+
+bool OTADashLogBuffer::begin(size_t bytes) {
+    size_t size = 1;
+    while ((size << 1) <= bytes) {
+        size <<= 1;
+    }
+
+    if (size < sizeof(OTADashLogRecord) * 4) {
+        return false;
+    }
+
+    if (storage && capacity() == size) {
+        clear();
+        return true;
+    }
+
+    end();
+    storage = static_cast<uint8_t*>(malloc(size));
+    if (!storage) {
+        return false;
+    }
+
+    mask = size - 1;
+    clear();
+    return true;
+}
+
+void OTADashLogBuffer::end() {
+    free(storage);
+    storage = nullptr;
+    mask    = 0;
+}
+
+void OTADashLogBuffer::clear() {
+    portENTER_CRITICAL(&writeLock);
+    uint32_t position = head.load(std::memory_order_relaxed);
+    tail.store(position, std::memory_order_release);
+    records.store(0, std::memory_order_relaxed);
+    portEXIT_CRITICAL(&writeLock);
+}
+
+void OTADashLogBuffer::append(const char* tag, const char* text, size_t len, uint32_t timestamp, uint8_t level, uint8_t core) {
+    if (!storage) {
+        return;
+    }
+
+    size_t tagLength = tag ? strnlen(tag, OTA_DASH_LOG_TAG_MAX) : 0;
+    size_t maxPayload = capacity() - sizeof(OTADashLogRecord) - tagLength;
+    if (len > OTA_DASH_LOG_LINE_MAX) len = OTA_DASH_LOG_LINE_MAX;
+    if (len > maxPayload)            len = maxPayload;
+
+    OTADashLogRecord record = { 0, timestamp, static_cast<uint16_t>(tagLength + len), level, core, static_cast<uint8_t>(tagLength) };
+    size_t needed = sizeof(record) + record.length;
+
+    portENTER_CRITICAL(&writeLock);
+    record.sequence = sequence.fetch_add(1, std::memory_order_relaxed);
+    while (capacity() - (head.load(std::memory_order_relaxed) - tail.load(std::memory_order_relaxed)) < needed) {
+        evictOldest();
+    }
+    if (maxRecords > 0) {
+        while (records.load(std::memory_order_relaxed) >= maxRecords) {
+            evictOldest();
+        }
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);                                                            // Readers must see the new tail before the overwrite
+
+    uint32_t position = head.load(std::memory_order_relaxed);
+    copyIn(position, &record, sizeof(record));
+    if (tagLength > 0) {
+        copyIn(position + sizeof(record), tag, tagLength);
+    }
+    copyIn(position + sizeof(record) + tagLength, text, len);
+    records.fetch_add(1, std::memory_order_relaxed);
+    head.store(position + needed, std::memory_order_release);                                                      // Publish only after the payload is in place
+    portEXIT_CRITICAL(&writeLock);
+}
+
+bool OTADashLogBuffer::read(uint32_t& cursor, OTADashLogRecord& record, char* out, size_t outSize) const {
+    if (!storage) {
+        return false;
+    }
+
+    while (true) {
+        uint32_t oldest = tail.load(std::memory_order_acquire);
+        uint32_t newest = head.load(std::memory_order_acquire);
+
+        if (static_cast<int32_t>(cursor - oldest) < 0) {                                                            // Reader fell behind, skip evicted records
+            cursor = oldest;
+        }
+        if (cursor == newest) {
+            return false;
+        }
+
+        copyOut(cursor, &record, sizeof(record));
+        size_t len = record.length;
+        bool sane = sizeof(record) + len <= newest - cursor;
+        size_t copied = 0;
+        if (sane && outSize > 0) {
+            copied = len < outSize ? len : outSize - 1;
+            copyOut(cursor + sizeof(record), out, copied);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (static_cast<int32_t>(cursor - tail.load(std::memory_order_relaxed)) < 0 || !sane) {                    // Overwritten while copying, retry from the tail
+            continue;
+        }
+
+        if (outSize > 0) {
+            out[copied] = '\0';
+        }
+        record.length = static_cast<uint16_t>(copied);
+        if (record.tagLength > copied) {
+            record.tagLength = static_cast<uint8_t>(copied);
+        }
+        cursor += sizeof(record) + len;
+        return true;
+    }
+}
+
+uint32_t OTADashLogBuffer::seek(uint32_t target) const {
+    if (!storage) {
+        return 0;
+    }
+
+    while (true) {
+        uint32_t position = tail.load(std::memory_order_acquire);
+        uint32_t newest   = head.load(std::memory_order_acquire);
+        bool valid        = true;
+
+        while (position != newest) {
+            OTADashLogRecord record;
+            copyOut(position, &record, sizeof(record));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (static_cast<int32_t>(position - tail.load(std::memory_order_relaxed)) < 0 ||
+                sizeof(record) + record.length > newest - position) {                                               // Header was overwritten, start over
+                valid = false;
+                break;
+            }
+            if (static_cast<int32_t>(record.sequence - target) >= 0) {
+                break;
+            }
+            position += sizeof(record) + record.length;
+        }
+
+        if (valid) {
+            return position;
+        }
+    }
+}
+
+void OTADashLogBuffer::evictOldest() {
+    uint32_t position = tail.load(std::memory_order_relaxed);
+    if (position == head.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    OTADashLogRecord record;
+    copyOut(position, &record, sizeof(record));
+    tail.store(position + sizeof(record) + record.length, std::memory_order_release);
+    records.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void OTADashLogBuffer::copyIn(uint32_t pos, const void* src, size_t len) {
+    size_t offset = pos & mask;
+    size_t first  = len < capacity() - offset ? len : capacity() - offset;
+    memcpy(storage + offset, src, first);
+    memcpy(storage, static_cast<const uint8_t*>(src) + first, len - first);
+}
+
+void OTADashLogBuffer::copyOut(uint32_t pos, void* dst, size_t len) const {
+    size_t offset = pos & mask;
+    size_t first  = len < capacity() - offset ? len : capacity() - offset;
+    memcpy(dst, storage + offset, first);
+    memcpy(static_cast<uint8_t*>(dst) + first, storage, len - first);
+}
+
+static constexpr size_t ARCHIVE_HEADER_MAX   = 10;                                                                  // Varint delta, level and core, tag length, varint length
+static constexpr size_t ARCHIVE_TABLE_BYTES  = sizeof(uint16_t) * OTA_DASH_LOG_ARCHIVE_TABLE_SIZE;
+static constexpr size_t ARCHIVE_DECODED_SIZE = OTA_DASH_LOG_ARCHIVE_BLOCK > ARCHIVE_TABLE_BYTES ? OTA_DASH_LOG_ARCHIVE_BLOCK : ARCHIVE_TABLE_BYTES;
+
+static uint8_t* putVarint(uint8_t* out, uint32_t value) {
+    while (value >= 0x80) {
+        *out++ = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<uint8_t>(value);
+    return out;
+}
+
+static bool getVarint(const uint8_t* data, size_t length, size_t& offset, uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 35 && offset < length; shift += 7) {
+        uint8_t byte = data[offset++];
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static size_t stageHeader(uint8_t* out, const OTADashLogRecord& record, uint32_t previousTime) {                    // The sequence is implied by the block
+    uint8_t* end = putVarint(out, record.timestamp - previousTime);
+    *end++ = static_cast<uint8_t>((record.level << 4) | record.core);
+    *end++ = record.tagLength;
+    end    = putVarint(end, record.length);
+    return end - out;
+}
+
+/*
+ * Block format, byte oriented so a block decodes in one pass:
+ *   0x00-0x1F  run of (byte + 1) literals
+ *   0x20-0x3F  repeat the previous match distance for (low five bits + 2) bytes
+ *   0x40-0x5F  one literal byte, then a repeat as above
+ *   0x60-0xFF  match of (top three bits) bytes, the low five bits and the next byte are the
+ *              distance minus one, so matches reach back 8 KB
+ * A length field at its maximum (31 for repeats, 7 for matches) is followed by a byte that
+ * adds to it. Log lines tend to differ from an earlier line by a digit or two and carry on at
+ * the same distance, which the repeat codes store in one or two bytes. Matches are found
+ * through a small table of hash buckets, with one step of lazy matching.
+ */
+size_t OTADashLogArchive::pack(const uint8_t* in, size_t len, uint8_t* out, size_t outSize, uint16_t* table) {
+    const size_t minMatch    = 3;
+    const size_t maxMatch    = 7 + 0xFF;
+    const size_t maxDistance = 0x2000;
+    const size_t ways        = OTA_DASH_LOG_ARCHIVE_HASH_WAYS;
+    size_t ip       = 0;
+    size_t op       = 0;
+    size_t anchor   = 0;
+    size_t previous = 0;                                                                                            // Distance of the last match, zero before the first
+
+    memset(table, 0, sizeof(uint16_t) * OTA_DASH_LOG_ARCHIVE_TABLE_SIZE);
+
+    auto bucket = [&](size_t at) -> uint16_t* {
+        uint32_t word = in[at] | (in[at + 1] << 8) | (in[at + 2] << 16);
+        return table + ((word * 2654435761u) >> (32 - OTA_DASH_LOG_ARCHIVE_HASH_BITS)) * ways;
+    };
+
+    auto insert = [&](size_t at) {
+        if (at + minMatch <= len) {
+            uint16_t* entries = bucket(at);
+            memmove(entries + 1, entries, sizeof(uint16_t) * (ways - 1));
+            entries[0] = static_cast<uint16_t>(at + 1);                                                             // Zero marks an empty entry
+        }
+    };
+
+    auto matching = [&](size_t at, size_t reference) -> size_t {
+        size_t limit  = len - at < maxMatch ? len - at : maxMatch;
+        size_t length = 0;
+        while (length < limit && in[reference + length] == in[at + length]) {
+            length++;
+        }
+        return length;
+    };
+
+    auto longest = [&](size_t at, size_t& distance) -> size_t {
+        if (at + minMatch > len) {
+            return 0;
+        }
+        const uint16_t* entries = bucket(at);
+        size_t best = 0;
+        for (size_t way = 0; way < ways && entries[way] != 0; way++) {
+            size_t reference = entries[way] - 1;
+            if (at - reference > maxDistance) {
+                break;
+            }
+            size_t length = matching(at, reference);
+            if (length > best) {
+                best     = length;
+                distance = at - reference;
+            }
+        }
+        return best >= minMatch ? best : 0;
+    };
+
+    auto repeat = [&](size_t at) -> size_t {
+        size_t length = previous > 0 && previous <= at && at < len ? matching(at, at - previous) : 0;
+        return length >= 2 ? length : 0;
+    };
+
+    auto literals = [&](size_t end) -> bool {
+        while (anchor < end) {
+            size_t run = end - anchor < 0x20 ? end - anchor : 0x20;
+            if (op + 1 + run > outSize) {
+                return false;
+            }
+            out[op++] = static_cast<uint8_t>(run - 1);
+            memcpy(out + op, in + anchor, run);
+            op     += run;
+            anchor += run;
+        }
+        return true;
+    };
+
+    while (ip < len) {
+        size_t distance = 0;
+        size_t length   = longest(ip, distance);
+        size_t again    = repeat(ip);
+        insert(ip);
+        if (again > 0 && again + 1 >= length) {                                                                     // A repeat is a byte shorter than a match
+            length   = again;
+            distance = previous;
+        } else if (length == 0) {
+            ip++;
+            continue;
+        } else {
+            size_t later = 0;
+            if (longest(ip + 1, later) > length || repeat(ip + 1) > length) {                                       // Longer one byte on, emit this byte as a literal
+                ip++;
+                continue;
+            }
+        }
+
+        bool single = distance == previous && ip - anchor == 1;                                                     // One changed byte, then the line carries on
+        if (!literals(single ? anchor : ip) || op + 3 > outSize) {
+            return 0;
+        }
+        if (distance == previous) {
+            size_t code = length - 2;
+            out[op++] = static_cast<uint8_t>((single ? 0x40 : 0x20) | (code < 31 ? code : 31));
+            if (single) {
+                out[op++] = in[anchor];
+            }
+            if (code >= 31) {
+                out[op++] = static_cast<uint8_t>(code - 31);
+            }
+        } else {
+            size_t code = length;
+            size_t back = distance - 1;
+            out[op++] = static_cast<uint8_t>(((code < 7 ? code : 7) << 5) | (back >> 8));
+            if (code >= 7) {
+                out[op++] = static_cast<uint8_t>(code - 7);
+            }
+            out[op++] = static_cast<uint8_t>(back);
+        }
+        previous = distance;
+
+        for (size_t i = 1; i < length; i++) {
+            insert(ip + i);
+        }
+        ip    += length;
+        anchor = ip;
+    }
+    return literals(len) ? op : 0;
+}
+
+size_t OTADashLogArchive::unpack(const uint8_t* in, size_t len, uint8_t* out, size_t outSize) {
+    size_t ip       = 0;
+    size_t op       = 0;
+    size_t previous = 0;
+
+    while (ip < len) {
+        uint8_t control = in[ip++];
+        if (control < 0x20) {
+            size_t run = control + 1;
+            if (ip + run > len || op + run > outSize) {
+                return 0;
+            }
+            memcpy(out + op, in + ip, run);
+            ip += run;
+            op += run;
+            continue;
+        }
+
+        bool repeat     = control < 0x60;
+        size_t length   = repeat ? (control & 0x1F) + 2 : (control >> 5);
+        size_t distance = previous;
+        if (control >= 0x40 && control < 0x60) {                                                                    // One literal before the repeat
+            if (ip >= len || op >= outSize) {
+                return 0;
+            }
+            out[op++] = in[ip++];
+        }
+        if (length == (repeat ? 33u : 7u)) {
+            if (ip >= len) {
+                return 0;
+            }
+            length += in[ip++];
+        }
+        if (!repeat) {
+            if (ip >= len) {
+                return 0;
+            }
+            distance = (((control & 0x1F) << 8) | in[ip++]) + 1;
+        }
+        if (distance == 0 || distance > op || op + length > outSize) {
+            return 0;
+        }
+        for (size_t i = 0; i < length; i++, op++) {                                                                 // Byte by byte, matches may overlap
+            out[op] = out[op - distance];
+        }
+        previous = distance;
+    }
+    return op;
+}
+
+OTADashLogArchive::~OTADashLogArchive() {
+    end();
+}
+
+bool OTADashLogArchive::begin(size_t bytes, uint32_t position) {
+    size_t size = 1;
+    while ((size << 1) <= bytes) {
+        size <<= 1;
+    }
+
+    end();
+    if (size < OTA_DASH_LOG_ARCHIVE_BLOCK * 2) {
+        return false;
+    }
+
+    storage = static_cast<uint8_t*>(malloc(size));
+    staging = static_cast<uint8_t*>(malloc(OTA_DASH_LOG_ARCHIVE_BLOCK));
+    decoded = static_cast<uint8_t*>(malloc(ARCHIVE_DECODED_SIZE));
+    packed  = static_cast<uint8_t*>(malloc(OTA_DASH_LOG_ARCHIVE_BLOCK));
+    if (!storage || !staging || !decoded || !packed) {
+        end();
+        return false;
+    }
+
+    mask   = size - 1;
+    cursor = position;
+    return true;
+}
+
+void OTADashLogArchive::end() {
+    free(storage);
+    free(staging);
+    free(decoded);
+    free(packed);
+    storage       = staging = decoded = packed = nullptr;
+    mask          = 0;
+    head          = tail = 0;
+    stagingUsed   = stagingRing = 0;
+    decodedFirst  = 0;
+    totalRaw      = totalPacked = 0;
+}
+
+void OTADashLogArchive::capture(const OTADashLogBuffer& log) {
+    if (!storage) {
+        return;
+    }
+
+    OTADashLogRecord record;
+    char payload[OTA_DASH_LOG_PAYLOAD_MAX + 1];
+    uint8_t header[ARCHIVE_HEADER_MAX];
+    size_t leadBytes   = log.capacity() - log.capacity() / 4;
+    size_t leadRecords = log.recordLimit() - log.recordLimit() / 4;
+    uint32_t next      = cursor;
+
+    while (log.read(next, record, payload, sizeof(payload))) {
+        uint32_t position = next - sizeof(record) - record.length;
+        bool evicting     = log.last() - position >= leadBytes ||                                                   // In the oldest quarter of the ring, by bytes or by count
+                            (leadRecords > 0 && log.nextSequence() - record.sequence >= leadRecords);
+        if (!evicting) {
+            return;
+        }
+
+        if (stagingUsed > 0 && record.sequence != stagingLast + 1) {                                                // The ring lapped the cursor, blocks hold consecutive sequences
+            flushStaging();
+        }
+        size_t headerLength = stageHeader(header, record, stagingUsed > 0 ? stagingTime : 0);
+        if (stagingUsed + headerLength + record.length > OTA_DASH_LOG_ARCHIVE_BLOCK) {
+            flushStaging();
+            headerLength = stageHeader(header, record, 0);
+        }
+        if (stagingUsed == 0) {
+            stagingFirst = record.sequence;
+        }
+        memcpy(staging + stagingUsed, header, headerLength);
+        memcpy(staging + stagingUsed + headerLength, payload, record.length);
+        stagingUsed += headerLength + record.length;
+        stagingRing += sizeof(record) + record.length;
+        stagingLast  = record.sequence;
+        stagingTime  = record.timestamp;
+        cursor       = next;
+    }
+}
+
+bool OTADashLogArchive::read(uint32_t& sequence, OTADashLogRecord& record, char* out, size_t outSize) {
+    if (!storage) {
+        return false;
+    }
+
+    const uint8_t* data = nullptr;
+    size_t length       = 0;
+    uint32_t current    = 0;
+
+    for (uint32_t position = tail; position != head; ) {                                                            // Oldest block that still holds sequence
+        Block block;
+        copyOut(position, &block, sizeof(block));
+        if (static_cast<int32_t>(block.lastSequence - sequence) >= 0) {
+            if (decodedFirst != block.firstSequence) {
+                decodedFirst = 0;
+                if (block.packedLength == block.rawLength) {
+                    copyOut(position + sizeof(block), decoded, block.rawLength);
+                    decodedLength = block.rawLength;
+                } else {
+                    copyOut(position + sizeof(block), packed, block.packedLength);
+                    decodedLength = unpack(packed, block.packedLength, decoded, OTA_DASH_LOG_ARCHIVE_BLOCK);
+                }
+                if (decodedLength != block.rawLength) {                                                             // Corrupt block, skip past it
+                    sequence = block.lastSequence + 1;
+                    position += sizeof(block) + block.packedLength;
+                    continue;
+                }
+                decodedFirst = block.firstSequence;
+            }
+            data    = decoded;
+            length  = decodedLength;
+            current = block.firstSequence;
+            break;
+        }
+        position += sizeof(block) + block.packedLength;
+    }
+
+    if (!data && stagingUsed > 0 && static_cast<int32_t>(stagingLast - sequence) >= 0) {
+        data    = staging;
+        length  = stagingUsed;
+        current = stagingFirst;
+    }
+
+    uint32_t timestamp = 0;
+    size_t offset      = 0;
+    while (data && offset < length) {
+        uint32_t delta;
+        uint32_t size;
+        if (!getVarint(data, length, offset, delta) || offset + 2 > length) {
+            return false;
+        }
+        uint8_t flags     = data[offset++];
+        uint8_t tagLength = data[offset++];
+        if (!getVarint(data, length, offset, size) || size > length - offset) {
+            return false;
+        }
+        timestamp += delta;
+
+        if (static_cast<int32_t>(current - sequence) >= 0) {
+            size_t copied = 0;
+            if (outSize > 0) {
+                copied = size < outSize ? size : outSize - 1;
+                memcpy(out, data + offset, copied);
+                out[copied] = '\0';
+            }
+            record.sequence  = current;
+            record.timestamp = timestamp;
+            record.length    = static_cast<uint16_t>(copied);
+            record.level     = flags >> 4;
+            record.core      = flags & 0x0F;
+            record.tagLength = tagLength < copied ? tagLength : static_cast<uint8_t>(copied);
+            sequence         = current + 1;
+            return true;
+        }
+        offset += size;
+        current++;
+    }
+    return false;
+}
+
+uint32_t OTADashLogArchive::firstSequence() const {
+    if (storage && tail != head) {
+        Block block;
+        copyOut(tail, &block, sizeof(block));
+        return block.firstSequence;
+    }
+    return stagingUsed > 0 ? stagingFirst : 0;
+}
+
+void OTADashLogArchive::flushStaging() {
+    if (stagingUsed == 0) {
+        return;
+    }
+
+    Block block   = { stagingFirst, stagingLast, static_cast<uint16_t>(stagingUsed), 0, static_cast<uint32_t>(stagingRing) };
+    decodedFirst  = 0;                                                                                              // The cached block doubles as the match table
+    size_t length = pack(staging, stagingUsed, packed, stagingUsed - 1, reinterpret_cast<uint16_t*>(decoded));      // Must be smaller than the input to be worth it
+    const uint8_t* data = packed;
+    if (length == 0) {
+        length = stagingUsed;
+        data   = staging;
+    }
+    block.packedLength = static_cast<uint16_t>(length);
+
+    size_t needed = sizeof(block) + length;
+    while (mask + 1 - (head - tail) < needed) {
+        dropOldest();
+    }
+    copyIn(head, &block, sizeof(block));
+    copyIn(head + sizeof(block), data, length);
+    head        += needed;
+    totalRaw    += block.ringLength;
+    totalPacked += length;
+    stagingUsed  = 0;
+    stagingRing  = 0;
+}
+
+void OTADashLogArchive::dropOldest() {
+    Block block;
+    copyOut(tail, &block, sizeof(block));
+    tail        += sizeof(block) + block.packedLength;
+    totalRaw    -= block.ringLength;
+    totalPacked -= block.packedLength;
+    if (decodedFirst == block.firstSequence) {
+        decodedFirst = 0;
+    }
+}
+
+void OTADashLogArchive::copyIn(uint32_t pos, const void* src, size_t len) {
+    size_t offset = pos & mask;
+    size_t first  = len < mask + 1 - offset ? len : mask + 1 - offset;
+    memcpy(storage + offset, src, first);
+    memcpy(storage, static_cast<const uint8_t*>(src) + first, len - first);
+}
+
+void OTADashLogArchive::copyOut(uint32_t pos, void* dst, size_t len) const {
+    size_t offset = pos & mask;
+    size_t first  = len < mask + 1 - offset ? len : mask + 1 - offset;
+    memcpy(dst, storage + offset, first);
+    memcpy(static_cast<uint8_t*>(dst) + first, storage, len - first);
+}
+
+size_t OTADashLogLine::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t OTADashLogLine::write(const uint8_t* buffer, size_t size) {
+    size_t room = OTA_DASH_LOG_LINE_MAX - used;
+    size_t take = size < room ? size : room;
+    memcpy(text + used, buffer, take);
+    used += take;
+    text[used] = '\0';
+    return size;                                                                                                    // Overflow is truncated, not reported as a write error
+}
+
+bool otaDashMatchesTagList(const char* list, const char* tag, size_t tagLength) {
+    while (*list) {
+        while (*list == ' ' || *list == ',') list++;
+        const char* start = list;
+        while (*list && *list != ',') list++;
+        const char* end = list;
+        while (end > start && end[-1] == ' ') end--;
+
+        size_t length = end - start;
+        if (length == 0) {
+            continue;
+        }
+        if (start[length - 1] == '*') {
+            if (length - 1 <= tagLength && strncmp(start, tag, length - 1) == 0) {
+                return true;
+            }
+        } else if (length == tagLength && strncmp(start, tag, length) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,232 @@
+/*
+ ====================================================================================================
+ * File:        OTADashLog.h
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.1.0
+ * Date:        Oct 17 2026
+ * Brief:       Fixed Capacity Ring Buffer Used To Store Wireless Debug Logs
+ *
+ ====================================================================================================
+ * License:
+ * MIT License
+ *
+ * Copyright (c) 2025 Hamas Saeed
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * For any inquiries, contact Hamas Saeed at hamasaeed@gmail.com
+ *
+ ====================================================================================================
+ */
+
+#ifndef OTADASH_LOG_H
+#define OTADASH_LOG_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "OTADashConfig.h"
+
+#ifndef OTA_DASH_LOG_BUFFER_SIZE
+    #define OTA_DASH_LOG_BUFFER_SIZE 8192                                                                           // Rounded down to a power of two
+#endif
+
+#ifndef OTA_DASH_LOG_LINE_MAX
+    #define OTA_DASH_LOG_LINE_MAX 256                                                                               // Longer lines are truncated
+#endif
+
+#ifndef OTA_DASH_LOG_TAG_MAX
+    #define OTA_DASH_LOG_TAG_MAX 15
+#endif
+
+#ifndef OTA_DASH_LOG_ARCHIVE
+    #define OTA_DASH_LOG_ARCHIVE 0                                                                                  // Compressed history behind the ring buffer
+#endif
+
+#ifndef OTA_DASH_LOG_ARCHIVE_SIZE
+    #define OTA_DASH_LOG_ARCHIVE_SIZE 16384                                                                         // Rounded down to a power of two
+#endif
+
+#ifndef OTA_DASH_LOG_ARCHIVE_BLOCK
+    #define OTA_DASH_LOG_ARCHIVE_BLOCK 8192                                                                         // Records are compressed this many bytes at a time
+#endif
+
+#define OTA_DASH_LOG_ARCHIVE_HASH_BITS 10
+#define OTA_DASH_LOG_ARCHIVE_HASH_WAYS 4                                                                            // Candidates kept per hash bucket, newest first
+#define OTA_DASH_LOG_ARCHIVE_TABLE_SIZE ((1u << OTA_DASH_LOG_ARCHIVE_HASH_BITS) * OTA_DASH_LOG_ARCHIVE_HASH_WAYS)
+
+static_assert(OTA_DASH_LOG_ARCHIVE_BLOCK < 0xFFFF, "Archive block positions are stored as u16");
+
+#define OTA_DASH_LOG_PAYLOAD_MAX (OTA_DASH_LOG_TAG_MAX + OTA_DASH_LOG_LINE_MAX)                                       // Tag bytes are stored in front of the text
+
+enum DebugLevel : uint8_t {                                                                                          // Same numbering as esp_log_level_t
+    DEBUG_LEVEL_NONE,
+    DEBUG_LEVEL_ERROR,
+    DEBUG_LEVEL_WARN,
+    DEBUG_LEVEL_INFO,
+    DEBUG_LEVEL_DEBUG,
+    DEBUG_LEVEL_VERBOSE
+};
+
+struct OTADashLogRecord {                                                                                           // Header stored in front of every payload
+    uint32_t sequence;
+    uint32_t timestamp;
+    uint16_t length;                                                                                                // Tag plus text
+    uint8_t  level      : 4;
+    uint8_t  core       : 4;
+    uint8_t  tagLength;
+};
+
+constexpr uint32_t otaDashHash(const char* data, size_t len, uint32_t hash = 2166136261u) {                           // FNV-1a
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ static_cast<uint8_t>(data[i])) * 16777619u;
+    }
+    return hash;
+}
+
+template <size_t N>
+constexpr uint32_t otaDashHash(const char (&text)[N]) {                                                              // String literals, usable as case labels
+    return otaDashHash(text, N - 1);
+}
+
+bool otaDashMatchesTagList(const char* list, const char* tag, size_t tagLength);                                    // Comma separated tags, a trailing * matches a prefix
+
+/*
+ * Byte ring of variable length records. Writers from any task are serialised by a short
+ * critical section that only covers the memcpy into the ring, oldest records are evicted
+ * to make room. Readers never take the lock: they copy a record out and then check that
+ * the tail did not move past it while copying, restarting from the tail if it did.
+ */
+class OTADashLogBuffer {
+public:
+    OTADashLogBuffer() = default;
+    ~OTADashLogBuffer();
+
+    OTADashLogBuffer(const OTADashLogBuffer&) = delete;
+    OTADashLogBuffer& operator=(const OTADashLogBuffer&) = delete;
+
+    bool begin(size_t bytes);
+    void end();
+    void clear();
+    void append(const char* tag, const char* text, size_t len, uint32_t timestamp, uint8_t level, uint8_t core);
+    bool read(uint32_t& cursor, OTADashLogRecord& record, char* out, size_t outSize) const;
+    uint32_t seek(uint32_t sequence) const;                                                                         // Position of the first record at or after sequence
+
+    void setMaxRecords(size_t records)      { maxRecords = records;                                 }
+    size_t recordLimit() const              { return maxRecords;                                    }               // Zero when only bytes limit the ring
+
+    bool isReady()      const               { return storage != nullptr;                            }
+    size_t capacity()   const               { return mask + 1;                                      }
+    size_t count()      const               { return records.load(std::memory_order_relaxed);       }
+    uint32_t first()    const               { return tail.load(std::memory_order_acquire);          }
+    uint32_t last()     const               { return head.load(std::memory_order_acquire);          }
+    uint32_t nextSequence() const           { return sequence.load(std::memory_order_acquire);      }
+
+private:
+    uint8_t*                                            storage                 = nullptr;
+    size_t                                              mask                    = 0;
+    size_t                                              maxRecords              = 0;
+    std::atomic<uint32_t>                               head                    {0};                                // Monotonic write position
+    std::atomic<uint32_t>                               tail                    {0};                                // Position of the oldest record
+    std::atomic<size_t>                                 records                 {0};
+    std::atomic<uint32_t>                               sequence                {1};                                // Zero is never assigned
+    portMUX_TYPE                                        writeLock               = portMUX_INITIALIZER_UNLOCKED;
+
+    void evictOldest();
+    void copyIn(uint32_t pos, const void* src, size_t len);
+    void copyOut(uint32_t pos, void* dst, size_t len) const;
+};
+
+/*
+ * Older history kept behind OTADashLogBuffer. Records are copied out of the ring once they
+ * reach its oldest quarter, so only lines about to be evicted are held twice. They are
+ * staged with a varint timestamp delta and no sequence (it is implied by the block), and the
+ * block is LZ compressed once it is full, oldest blocks are dropped to make room. Blocks are
+ * only decompressed when a client replays history, one block is cached so sequential reads
+ * decode each block once. Not thread safe, capture() and read() must run on the same task.
+ */
+class OTADashLogArchive {
+public:
+    OTADashLogArchive() = default;
+    ~OTADashLogArchive();
+
+    OTADashLogArchive(const OTADashLogArchive&) = delete;
+    OTADashLogArchive& operator=(const OTADashLogArchive&) = delete;
+
+    bool begin(size_t bytes, uint32_t position);                                                                    // Start archiving from this ring position
+    void end();
+    void capture(const OTADashLogBuffer& log);                                                                      // Archive the records the ring is about to evict
+    bool read(uint32_t& sequence, OTADashLogRecord& record, char* out, size_t outSize);                             // First record at or after sequence, advances it
+
+    bool isReady()      const               { return storage != nullptr;                            }
+    uint32_t firstSequence() const;                                                                                 // Zero when the archive is empty
+    size_t rawBytes()   const               { return totalRaw;                                      }               // Ring bytes the packed blocks stand in for
+    size_t packedBytes() const              { return totalPacked;                                   }
+
+    static size_t pack(const uint8_t* in, size_t len, uint8_t* out, size_t outSize, uint16_t* table);
+    static size_t unpack(const uint8_t* in, size_t len, uint8_t* out, size_t outSize);
+
+private:
+    struct Block {
+        uint32_t firstSequence;
+        uint32_t lastSequence;
+        uint16_t rawLength;
+        uint16_t packedLength;                                                                                      // Equal to rawLength when stored uncompressed
+        uint32_t ringLength;                                                                                        // The same records with ring headers
+    };
+
+    uint8_t*                                            storage                 = nullptr;
+    uint8_t*                                            staging                 = nullptr;
+    uint8_t*                                            decoded                 = nullptr;
+    uint8_t*                                            packed                  = nullptr;
+    size_t                                              mask                    = 0;
+    size_t                                              stagingUsed             = 0;
+    size_t                                              stagingRing             = 0;
+    size_t                                              decodedLength           = 0;
+    size_t                                              totalRaw                = 0;
+    size_t                                              totalPacked             = 0;
+    uint32_t                                            head                    = 0;
+    uint32_t                                            tail                    = 0;
+    uint32_t                                            cursor                  = 0;                                // Position in the log ring
+    uint32_t                                            stagingFirst            = 0;
+    uint32_t                                            stagingLast             = 0;
+    uint32_t                                            stagingTime             = 0;                                // Timestamp of the last staged record
+    uint32_t                                            decodedFirst            = 0;                                // First sequence of the cached block, 0 when empty
+
+    void flushStaging();
+    void dropOldest();
+    void copyIn(uint32_t pos, const void* src, size_t len);
+    void copyOut(uint32_t pos, void* dst, size_t len) const;
+};
+
+class OTADashLogLine : public Print {                                                                               // Stack allocated Print target for one log line
+public:
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+    void clear()                            { used = 0; text[0] = '\0';                            }
+    const char* c_str() const               { return text;                                          }
+    size_t length()     const               { return used;                                          }
+
+private:
+    char                                                text[OTA_DASH_LOG_LINE_MAX + 1] = {};
+    size_t                                              used                    = 0;
+};
+
+#endif // OTADASH_LOG_H
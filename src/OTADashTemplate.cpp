@@ -0,0 +1,62 @@
+/*
+ ====================================================================================================
+ * File:        OTADashTemplate.cpp
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.1.0
+ * Date:        Oct 17 2026
+ * Brief:       Page Templates Parsed Once And Streamed In Chunks
+ *
+ ====================================================================================================
+ * License:
+ * MIT License
+ *
+ * Copyright (c) 2025 Hamas Saeed
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * For any inquiries, contact Hamas Saeed at hamasaeed@gmail.com
+ *
+ ====================================================================================================
+ */
+
+#include "OTADashTemplate.h"
+
+size_t OTADashTemplate::render(uint8_t* buffer, size_t maxLen, TemplateCursor& cursor, const TemplateValue* values) const {
+    size_t written = 0;
+
+    while (written < maxLen && cursor.segment < count) {
+        const TemplateSegment& segment = segments[cursor.segment];
+        const char* text = segment.slot == TEMPLATE_TEXT ? source + segment.offset : values[segment.slot].text;
+        size_t length    = segment.slot == TEMPLATE_TEXT ? segment.length : values[segment.slot].length;
+
+        size_t take = cursor.offset < length ? length - cursor.offset : 0;
+        if (take > maxLen - written) {
+            take = maxLen - written;
+        }
+        memcpy(buffer + written, text + cursor.offset, take);
+        written       += take;
+        cursor.offset += take;
+
+        if (cursor.offset >= length) {
+            cursor.segment++;
+            cursor.offset = 0;
+        }
+    }
+    return written;                                                                                                 // Zero ends the chunked response
+}
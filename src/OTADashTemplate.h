@@ -0,0 +1,190 @@
+/*
+ ====================================================================================================
+ * File:        OTADashTemplate.h
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.1.0
+ * Date:        Oct 17 2026
+ * Brief:       Page Templates Parsed Once And Streamed In Chunks
+ *
+ ====================================================================================================
+ * License:
+ * MIT License
+ *
+ * Copyright (c) 2025 Hamas Saeed
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * For any inquiries, contact Hamas Saeed at hamasaeed@gmail.com
+ *
+ ====================================================================================================
+ */
+
+#ifndef OTADASH_TEMPLATE_H
+#define OTADASH_TEMPLATE_H
+
+#include <Arduino.h>
+#include "OTADashLog.h"
+
+enum TemplateSlot : uint8_t {                                                                                       // %NAME% markers a page may contain
+    TEMPLATE_PORTAL_HEADING,
+    TEMPLATE_CUSTOM_DOMAIN,
+    TEMPLATE_CUSTOM_CONTENT,
+    TEMPLATE_SLOT_COUNT,
+    TEMPLATE_TEXT = 0xFF                                                                                            // Static text copied from the source
+};
+
+static constexpr const char* templateSlotNames[TEMPLATE_SLOT_COUNT] = {
+    "PORTAL_HEADING",
+    "CUSTOM_DOMAIN",
+    "CUSTOM_CONTENT"
+};
+
+struct TemplateSegment {
+    uint16_t offset;                                                                                                // Into the source literal
+    uint16_t length;
+    uint8_t  slot;
+};
+
+struct TemplateValue {
+    const char* text;
+    size_t      length;
+};
+
+struct TemplateCursor {                                                                                             // Progress of one chunked response
+    size_t segment = 0;
+    size_t offset  = 0;
+};
+
+struct TemplateResponse {                                                                                           // Shared by the chunks of one response
+    TemplateCursor cursor;
+    String         values[TEMPLATE_SLOT_COUNT];                                                                     // Copied when the response starts, so every chunk agrees with the ETag
+};
+
+template <size_t N>
+struct TemplateSpans {
+    TemplateSegment segment[N > 0 ? N : 1];
+};
+
+/*
+ * Compile time splitting. A marker is '%', one or more of [A-Z_] and '%'; any other '%' is
+ * plain text. These run inside static_assert and constexpr initialisers only.
+ */
+constexpr size_t templateLength(const char* source) {
+    size_t length = 0;
+    while (source[length]) length++;
+    return length;
+}
+
+constexpr size_t templateMarkerEnd(const char* source, size_t length, size_t start) {                              // Index of the closing '%', 0 if none
+    if (source[start] != '%') {
+        return 0;
+    }
+    size_t end = start + 1;
+    while (end < length && ((source[end] >= 'A' && source[end] <= 'Z') || source[end] == '_')) end++;
+    return end < length && end > start + 1 && source[end] == '%' ? end : 0;
+}
+
+constexpr int templateFindSlot(const char* name, size_t length) {
+    for (int slot = 0; slot < TEMPLATE_SLOT_COUNT; slot++) {
+        const char* candidate = templateSlotNames[slot];
+        size_t i = 0;
+        while (i < length && candidate[i] == name[i]) i++;
+        if (i == length && candidate[i] == '\0') {
+            return slot;
+        }
+    }
+    return -1;
+}
+
+constexpr bool templateIsValid(const char* source) {                                                                // False if a marker names no TemplateSlot
+    size_t length = templateLength(source);
+    for (size_t i = 0; i < length; i++) {
+        size_t end = templateMarkerEnd(source, length, i);
+        if (end && templateFindSlot(source + i + 1, end - i - 1) < 0) {
+            return false;
+        }
+        if (end) i = end;
+    }
+    return true;
+}
+
+template <size_t N>
+constexpr TemplateSpans<N> templateSplit(const char* source, size_t* count = nullptr) {
+    TemplateSpans<N> spans {};
+    size_t length = templateLength(source);
+    size_t start  = 0;
+    size_t used   = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        size_t end = templateMarkerEnd(source, length, i);
+        int slot   = end ? templateFindSlot(source + i + 1, end - i - 1) : -1;
+        if (slot < 0) {
+            continue;
+        }
+        if (i > start) {
+            if (used < N) spans.segment[used] = { static_cast<uint16_t>(start), static_cast<uint16_t>(i - start), TEMPLATE_TEXT };
+            used++;
+        }
+        if (used < N) spans.segment[used] = { 0, 0, static_cast<uint8_t>(slot) };
+        used++;
+        start = end + 1;
+        i     = end;
+    }
+    if (length > start) {
+        if (used < N) spans.segment[used] = { static_cast<uint16_t>(start), static_cast<uint16_t>(length - start), TEMPLATE_TEXT };
+        used++;
+    }
+    if (count) *count = used;
+    return spans;
+}
+
+constexpr size_t templateSegmentCount(const char* source) {                                                          // Dry run of templateSplit to size the table
+    size_t count = 0;
+    templateSplit<0>(source, &count);
+    return count;
+}
+
+/*
+ * A page literal split at its %NAME% markers into static spans and slots. The span table is
+ * built by the compiler and lives in flash next to the literal, rendering walks the spans
+ * and copies them, and the slot values supplied for this request, straight into the
+ * response buffer a chunk at a time.
+ */
+class OTADashTemplate {
+public:
+    constexpr OTADashTemplate(const char* source, const TemplateSegment* segments, size_t count, uint32_t hash) :
+        source(source), segments(segments), count(count), hash(hash) {}
+
+    size_t render(uint8_t* buffer, size_t maxLen, TemplateCursor& cursor, const TemplateValue* values) const;
+    uint32_t sourceHash() const { return hash; }                                                                    // FNV-1a of the literal, seeds ETags
+
+private:
+    const char*                                         source;
+    const TemplateSegment*                              segments;
+    size_t                                              count;
+    uint32_t                                            hash;
+};
+
+#define OTA_DASH_TEMPLATE(name, literal)                                                                            \
+    static_assert(templateIsValid(literal), "Unknown %PLACEHOLDER% in " #literal);                                  \
+    static constexpr TemplateSpans<templateSegmentCount(literal)> name##Spans =                                    \
+        templateSplit<templateSegmentCount(literal)>(literal);                                                      \
+    static constexpr OTADashTemplate name(literal, name##Spans.segment, templateSegmentCount(literal), otaDashHash(literal))
+
+#endif // OTADASH_TEMPLATE_H
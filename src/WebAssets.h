@@ -0,0 +1,1613 @@
+/*
+ ====================================================================================================
+ * File:        WebAssets.h
+ * Brief:       Minified web assets, gzip-precompressed unless OTA_DASH_GZIP_ASSETS is 0.
+ *              Generated by tools/build_assets.py, do not edit.
+ *              Sources are the "web pages/" html files and "styles/otadash style.css".
+ ====================================================================================================
+ */
+
+#ifndef WEBPAGES_ASSETS_H
+#define WEBPAGES_ASSETS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef OTA_DASH_GZIP_ASSETS
+    #error "Include OTADash.h before WebAssets.h"
+#endif
+
+struct OTADashAsset {
+    const char*     type;
+    const char*     encoding;                                                                           // Content-Encoding, nullptr for plain text
+    const uint8_t*  data;
+    size_t          length;
+    size_t          rawLength;                                                                          // Minified, before compression
+    const char*     hash;                                                                               // First 8 hex digits of the minified content's SHA-256, used as ETag
+};
+
+// device_info_html: 2512 bytes minified, 1003 bytes gzip
+#if OTA_DASH_GZIP_ASSETS
+static const uint8_t device_info_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x56, 0xef, 0x72, 0xe2, 0x36,
+  0x10, 0xff, 0xce, 0x53, 0xa8, 0x9e, 0xb9, 0xb1, 0x99, 0xcb, 0x61, 0x48, 0x53, 0x7a, 0xbd, 0x60,
+  0x6e, 0x12, 0x92, 0x4c, 0x98, 0x96, 0x96, 0x09, 0xb9, 0x9b, 0xe9, 0x47, 0xc5, 0x5a, 0x62, 0x35,
+  0xb6, 0xe4, 0x4a, 0x32, 0x1c, 0xe9, 0xdc, 0x3b, 0xdd, 0x33, 0xdc, 0x93, 0x75, 0x25, 0x61, 0xe0,
+  0x00, 0x27, 0x5f, 0xb0, 0xb5, 0xfb, 0xfb, 0xed, 0x3f, 0x76, 0xd7, 0x1a, 0xfc, 0x74, 0xf5, 0xd7,
+  0xe8, 0xfe, 0xef, 0xe9, 0x35, 0xb9, 0xbd, 0x9f, 0xfc, 0x31, 0x1c, 0x64, 0xa6, 0xc8, 0x87, 0xad,
+  0x41, 0x06, 0x94, 0xe1, 0xc3, 0x70, 0x93, 0xc3, 0xf0, 0x0a, 0x16, 0x3c, 0x05, 0x32, 0x16, 0x73,
+  0x39, 0x88, 0xbd, 0xa8, 0x35, 0x28, 0xc0, 0x50, 0x22, 0x68, 0x01, 0x49, 0xb0, 0xe0, 0xb0, 0x2c,
+  0xa5, 0x32, 0x01, 0x49, 0xa5, 0x30, 0x20, 0x4c, 0x12, 0x2c, 0x39, 0x33, 0x59, 0xc2, 0x1c, 0xf1,
+  0x9d, 0x3b, 0x9c, 0x10, 0x2e, 0xb8, 0xe1, 0x34, 0x7f, 0xa7, 0x53, 0x9a, 0x43, 0xd2, 0x0b, 0xd0,
+  0x48, 0xce, 0xc5, 0x13, 0x51, 0x90, 0x27, 0x81, 0x36, 0xab, 0x1c, 0x74, 0x06, 0x80, 0x56, 0x32,
+  0x05, 0xf3, 0x24, 0x88, 0xbd, 0xa8, 0x93, 0x6a, 0xfd, 0x71, 0x91, 0xfc, 0x96, 0x76, 0xfb, 0x3d,
+  0xd6, 0x7d, 0x9d, 0x65, 0x32, 0x28, 0xc0, 0x92, 0x2c, 0x32, 0x5e, 0xe7, 0xf1, 0x20, 0xd9, 0x0a,
+  0x1f, 0x8c, 0x2f, 0x48, 0x9a, 0x53, 0xad, 0x93, 0xc0, 0x46, 0x4a, 0xb9, 0x00, 0x65, 0x61, 0x59,
+  0xef, 0xc7, 0x1c, 0xf1, 0x8c, 0xb9, 0xd3, 0x87, 0x1c, 0x08, 0x67, 0x49, 0xe0, 0xd3, 0xb0, 0x2a,
+  0x0b, 0x36, 0x6a, 0x38, 0x30, 0xd9, 0x70, 0xaa, 0x64, 0x09, 0xca, 0xac, 0xb0, 0x22, 0x99, 0x13,
+  0x7c, 0xa6, 0x79, 0x05, 0xfe, 0x14, 0x23, 0x06, 0x9d, 0x3b, 0x0b, 0xf8, 0x42, 0xeb, 0xd8, 0x82,
+  0xda, 0xfb, 0x43, 0x65, 0x8c, 0x14, 0xc1, 0xf0, 0x92, 0xa6, 0x4f, 0x83, 0x98, 0x22, 0x46, 0xa7,
+  0x8a, 0x97, 0x66, 0xd8, 0x9a, 0x57, 0x22, 0x35, 0x5c, 0x0a, 0x32, 0x97, 0xaa, 0xa0, 0xe6, 0x72,
+  0x65, 0x40, 0x47, 0x0f, 0xf6, 0xb7, 0x4d, 0xfe, 0x6b, 0xf1, 0x39, 0xf1, 0x07, 0x32, 0x4c, 0x48,
+  0xaf, 0x7b, 0xf6, 0xfe, 0x97, 0x5f, 0xfb, 0x6d, 0x2c, 0x85, 0xa9, 0x94, 0xa8, 0x35, 0xf1, 0x46,
+  0xd1, 0x31, 0xf2, 0x86, 0x7f, 0x01, 0x16, 0x9d, 0xb6, 0xc9, 0x5b, 0x12, 0x92, 0xc9, 0x65, 0x78,
+  0xbe, 0x6f, 0xe2, 0xf4, 0xec, 0x18, 0x1f, 0xa5, 0x1b, 0x72, 0xcf, 0x93, 0x7f, 0xb7, 0xe4, 0x35,
+  0xd2, 0x03, 0xad, 0xd4, 0xbd, 0xa1, 0xe2, 0xeb, 0x7e, 0xe0, 0x9f, 0x4a, 0xc3, 0x0b, 0x88, 0x0a,
+  0x17, 0x76, 0x0e, 0x86, 0x68, 0xc0, 0x92, 0x33, 0x4d, 0x12, 0x32, 0xa1, 0x26, 0xeb, 0xcc, 0x73,
+  0x29, 0x15, 0xaa, 0x9d, 0xbb, 0x6e, 0xb7, 0x7d, 0xde, 0x42, 0xb5, 0x36, 0x84, 0xd1, 0xd5, 0x1e,
+  0xa6, 0x26, 0xc6, 0xe4, 0x7d, 0xff, 0x6c, 0x07, 0x99, 0xc9, 0x4a, 0x35, 0x42, 0x7f, 0xee, 0x23,
+  0x92, 0xbc, 0x21, 0xa7, 0x67, 0x35, 0xbc, 0xe0, 0xa2, 0xb2, 0x51, 0x37, 0x10, 0xfa, 0x0e, 0xde,
+  0xef, 0x9e, 0xb7, 0x6a, 0xd9, 0x9b, 0xc4, 0x1d, 0xeb, 0xe2, 0xb8, 0xc0, 0x3e, 0xfa, 0xf8, 0x30,
+  0x73, 0x86, 0xc9, 0x7f, 0x20, 0x61, 0x68, 0x8b, 0xe3, 0x23, 0x41, 0x61, 0x86, 0xc2, 0xb7, 0x1b,
+  0x4f, 0x28, 0x28, 0x9c, 0xa0, 0xb6, 0x88, 0x82, 0xbd, 0x5a, 0x51, 0xc6, 0xee, 0xe4, 0x32, 0x72,
+  0x8d, 0x72, 0xe2, 0xa6, 0xe9, 0x84, 0x2c, 0x6c, 0x1f, 0xd9, 0xaa, 0xf9, 0xb8, 0x95, 0x5c, 0x62,
+  0xcc, 0x0e, 0xd1, 0xe1, 0x42, 0x63, 0xcb, 0x59, 0x06, 0x56, 0x01, 0x15, 0x6b, 0xc1, 0x08, 0xf2,
+  0x3c, 0xc2, 0x3f, 0x0c, 0xbe, 0x98, 0x91, 0x1f, 0x40, 0x64, 0x58, 0x63, 0xaf, 0x82, 0x9c, 0x2f,
+  0x17, 0x11, 0x98, 0x34, 0x8b, 0xc2, 0x98, 0x96, 0x3c, 0xe6, 0xd8, 0xe8, 0x61, 0xbb, 0xd5, 0xc1,
+  0x49, 0x12, 0x91, 0x02, 0x5d, 0x62, 0x1c, 0x40, 0x92, 0x21, 0xa9, 0xdf, 0x3b, 0xff, 0x68, 0x29,
+  0xa2, 0x76, 0x0d, 0xb1, 0x78, 0xab, 0xae, 0x23, 0xf6, 0x83, 0x93, 0x10, 0x26, 0xd3, 0xaa, 0x40,
+  0x3f, 0x9d, 0x47, 0x30, 0xd7, 0x39, 0xd8, 0xd7, 0xcb, 0xd5, 0x98, 0x45, 0xe1, 0x76, 0x9e, 0x42,
+  0xcc, 0xe3, 0xc7, 0x1a, 0x84, 0x38, 0x57, 0xac, 0x4a, 0x0d, 0xf9, 0x13, 0xe3, 0x0f, 0xed, 0xd2,
+  0x98, 0xcb, 0x4e, 0xe9, 0x65, 0x87, 0xe0, 0x1b, 0xae, 0x8a, 0x25, 0x55, 0x40, 0x3e, 0x83, 0xd2,
+  0x58, 0xd0, 0x9a, 0x30, 0x5f, 0xcb, 0x0f, 0x19, 0xa3, 0x8c, 0x97, 0x64, 0x22, 0x19, 0xe4, 0x35,
+  0x36, 0x45, 0x89, 0x13, 0x34, 0x80, 0x47, 0x12, 0xf3, 0xde, 0x05, 0x3b, 0x41, 0x03, 0xf8, 0x0e,
+  0x53, 0xdb, 0x0d, 0xc4, 0xe2, 0x6b, 0xd9, 0x11, 0xca, 0xf4, 0x13, 0xb9, 0x51, 0xf0, 0x6f, 0x05,
+  0x22, 0x5d, 0x6d, 0x28, 0x65, 0x65, 0x65, 0x93, 0xdb, 0x67, 0x3f, 0xb4, 0xb7, 0xcf, 0x61, 0x83,
+  0xb3, 0x7b, 0x28, 0x70, 0x05, 0x51, 0xec, 0xcf, 0x4d, 0xa5, 0xcc, 0x56, 0xb4, 0x3f, 0xc0, 0xdf,
+  0xbf, 0x8d, 0x8e, 0x18, 0xba, 0x48, 0x53, 0xd0, 0x9a, 0x4c, 0x25, 0xc7, 0x86, 0x98, 0xcd, 0xc6,
+  0x57, 0xb5, 0x25, 0x5a, 0xda, 0xd3, 0x2b, 0x84, 0xf1, 0x94, 0x5c, 0x30, 0x86, 0xe5, 0xd0, 0x5b,
+  0xda, 0x78, 0x7a, 0x24, 0x5c, 0x29, 0x04, 0xa4, 0x06, 0x18, 0x19, 0xe5, 0x1c, 0xfb, 0x60, 0x07,
+  0xbe, 0x16, 0xb4, 0xfd, 0x66, 0xf2, 0x15, 0xa8, 0xd1, 0x76, 0x0a, 0xf6, 0x2c, 0xcd, 0x0c, 0x75,
+  0x93, 0x73, 0xe8, 0x99, 0x97, 0x87, 0x7e, 0x67, 0xfc, 0x51, 0xd0, 0x9c, 0xcc, 0x8c, 0x02, 0xf1,
+  0x68, 0xb2, 0x1a, 0xaa, 0xb4, 0xe6, 0xae, 0x26, 0xec, 0xb2, 0xb0, 0x35, 0xf9, 0x7a, 0xd0, 0x57,
+  0xb8, 0xa6, 0x33, 0x32, 0xe3, 0xcf, 0xb6, 0xb0, 0xbb, 0x9b, 0xd8, 0x77, 0x97, 0xd5, 0x5a, 0x65,
+  0xfb, 0x48, 0x47, 0x7a, 0x66, 0x09, 0xc0, 0x90, 0xba, 0x8b, 0xb7, 0xa2, 0xf5, 0xb6, 0xb3, 0x0b,
+  0xef, 0x85, 0x3f, 0x77, 0xf6, 0x64, 0xa7, 0xb1, 0xd1, 0xbd, 0x76, 0xea, 0x26, 0xff, 0x0a, 0x80,
+  0xd4, 0x06, 0x4a, 0x9a, 0xbe, 0x64, 0xc1, 0xaa, 0x8f, 0x98, 0xb8, 0x05, 0x5a, 0x36, 0x3a, 0xc7,
+  0x0f, 0x6a, 0xf9, 0x92, 0x6b, 0x4b, 0x3e, 0x5a, 0x33, 0x54, 0x5a, 0xdd, 0x11, 0xde, 0x04, 0x2f,
+  0x06, 0x45, 0x55, 0x90, 0x17, 0xf9, 0xb8, 0x54, 0x6f, 0x76, 0x4c, 0x6c, 0x7a, 0xa5, 0xd4, 0x8a,
+  0x16, 0x2e, 0xa0, 0xc3, 0x5e, 0x99, 0xce, 0xee, 0x2e, 0x26, 0x8d, 0x99, 0x6c, 0x99, 0x0d, 0xa9,
+  0x38, 0x7a, 0x53, 0x2e, 0x53, 0xcb, 0x6e, 0x1f, 0xeb, 0x1d, 0xff, 0xe5, 0xdb, 0xf0, 0xd6, 0x1f,
+  0x42, 0x47, 0xac, 0xdc, 0xbb, 0x63, 0xe1, 0xf2, 0x4c, 0xa9, 0xdd, 0xb9, 0xa0, 0x94, 0x54, 0xdb,
+  0xf5, 0x29, 0x71, 0xcd, 0x3b, 0x51, 0x14, 0x5e, 0xdb, 0xc7, 0x07, 0x34, 0xe4, 0xce, 0x8e, 0x74,
+  0x8e, 0xb7, 0x8a, 0xfa, 0xa6, 0x30, 0x88, 0xf1, 0x3a, 0x63, 0x1f, 0xeb, 0xcb, 0x4d, 0xec, 0xae,
+  0x6e, 0xff, 0x03, 0xc5, 0x14, 0x63, 0xab, 0xd0, 0x09, 0x00, 0x00,
+};
+static const OTADashAsset device_info_html_asset = { "text/html", "gzip", device_info_html_gz, sizeof(device_info_html_gz), 2512, "14fc855e" };
+#else
+static const char device_info_html_text[] = R"rawliteral(<!DOCTYPE HTML><html>
+<head>
+<title>Device Info</title>
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<link rel="stylesheet" href="/styles.css?v=9c061d01">
+<link rel="stylesheet" href="/theme.css">
+</head>
+<body>
+<div class="container">
+<h1>Device Info</h1>
+<table id="deviceInfo">
+<tr><th>Property</th><th>Value</th></tr>
+</table>
+<a href="/" class="button">Back</a>
+<script>
+function formatBytes(bytes) {
+if (bytes >= 1048576) return (bytes / 1048576).toFixed(2) + ' MB';
+if (bytes >= 1024) return (bytes / 1024).toFixed(1) + ' KB';
+return bytes + ' bytes';
+}
+function formatUptime(ms) {
+let seconds = Math.floor(ms / 1000);
+const days = Math.floor(seconds / 86400);
+const hours = Math.floor(seconds / 3600) % 24;
+const minutes = Math.floor(seconds / 60) % 60;
+seconds %= 60;
+return (days ? days + 'd ' : '') + hours + 'h ' + minutes + 'm ' + seconds + 's';
+}
+function addRow(table, name, value) {
+const row = table.insertRow();
+row.insertCell().textContent = name;
+row.insertCell().textContent = value;
+}
+fetch('/api/info')
+.then(response => response.json())
+.then(info => {
+const table = document.getElementById('deviceInfo');
+addRow(table, 'Product Name', info.product);
+addRow(table, 'Firmware Version', info.firmware);
+addRow(table, 'Chip Model', info.chipModel);
+addRow(table, 'Chip Cores', info.chipCores);
+addRow(table, 'Chip Revision', info.chipRevision);
+addRow(table, 'CPU Frequency', info.cpuFreqMHz + ' MHz');
+addRow(table, 'Chip Temperature', info.temperature.toFixed(1) + ' °C');
+addRow(table, 'Access Point SSID', info.apSSID);
+addRow(table, 'Access Point IP Address', info.apIP);
+addRow(table, 'Connected Clients', info.apClients);
+if (info.connected) {
+addRow(table, 'Station IP Address', info.ip);
+addRow(table, 'Signal Strength', info.rssi + ' dBm');
+}
+addRow(table, 'Flash Size', formatBytes(info.flashSize));
+addRow(table, 'Flash Speed', (info.flashSpeed / 1000000) + ' MHz');
+addRow(table, 'Sketch Size', formatBytes(info.sketchSize));
+addRow(table, 'Free Sketch Space', formatBytes(info.sketchSpace));
+addRow(table, 'Heap Size', formatBytes(info.heapSize));
+addRow(table, 'Free Heap', formatBytes(info.freeHeap));
+addRow(table, 'Minimum Free Heap', formatBytes(info.minFreeHeap));
+if (info.psramSize) {
+addRow(table, 'PSRAM Size', formatBytes(info.psramSize));
+addRow(table, 'Free PSRAM', formatBytes(info.freePsram));
+}
+addRow(table, 'Uptime', formatUptime(info.uptime));
+})
+.catch(error => {
+console.error('Error:', error);
+});
+</script>
+</div>
+</body>
+</html>)rawliteral";
+static const OTADashAsset device_info_html_asset = { "text/html", nullptr, reinterpret_cast<const uint8_t*>(device_info_html_text), sizeof(device_info_html_text) - 1, 2512, "14fc855e" };
+#endif
+
+// wifi_manage_html: 2794 bytes minified, 1210 bytes gzip
+#if OTA_DASH_GZIP_ASSETS
+static const uint8_t wifi_manage_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x56, 0x6d, 0x6b, 0x23, 0x37,
+  0x10, 0xfe, 0xee, 0x5f, 0xa1, 0x13, 0x05, 0xaf, 0xa9, 0xbd, 0x9b, 0x7c, 0xb8, 0x92, 0x26, 0x5e,
+  0x17, 0xf2, 0x46, 0x53, 0xee, 0x92, 0x50, 0xa7, 0x84, 0x52, 0x0a, 0x27, 0xaf, 0xc6, 0xb6, 0x88,
+  0x2c, 0x2d, 0x92, 0x6c, 0xd7, 0x84, 0xfc, 0xf7, 0xce, 0x68, 0x5f, 0xec, 0x4d, 0xc2, 0x85, 0xfb,
+  0xb4, 0xab, 0xd1, 0xcc, 0x33, 0x2f, 0x7a, 0x66, 0xa4, 0xf1, 0xa7, 0xcb, 0xbb, 0x8b, 0x87, 0xbf,
+  0xef, 0xaf, 0xd8, 0xef, 0x0f, 0x5f, 0xbf, 0x4c, 0x7a, 0xe3, 0x65, 0x58, 0x69, 0xa6, 0x85, 0x59,
+  0xe4, 0x1c, 0x0c, 0x27, 0x01, 0x08, 0x89, 0x9f, 0x15, 0x04, 0xc1, 0x8a, 0xa5, 0x70, 0x1e, 0x42,
+  0xce, 0xff, 0x7a, 0xb8, 0x1e, 0x9d, 0xf0, 0x46, 0x6c, 0xc4, 0x0a, 0x72, 0xbe, 0x51, 0xb0, 0x2d,
+  0xad, 0x0b, 0x9c, 0x15, 0xd6, 0x04, 0x30, 0xa8, 0xb6, 0x55, 0x32, 0x2c, 0x73, 0x09, 0x1b, 0x55,
+  0xc0, 0x28, 0x2e, 0x86, 0x4c, 0x19, 0x15, 0x94, 0xd0, 0x23, 0x5f, 0x08, 0x0d, 0xf9, 0x71, 0x7a,
+  0x44, 0x30, 0x41, 0x05, 0x0d, 0x93, 0x47, 0x75, 0xad, 0xd8, 0x57, 0x61, 0xc4, 0x02, 0x56, 0x68,
+  0x3f, 0xce, 0x2a, 0x71, 0x6f, 0xac, 0x95, 0x79, 0x62, 0x0e, 0x74, 0xce, 0x7d, 0xd8, 0x69, 0xf0,
+  0x4b, 0x00, 0x74, 0xb3, 0x74, 0x30, 0xcf, 0x79, 0x56, 0x89, 0xd2, 0xc2, 0xfb, 0xdf, 0x36, 0xf9,
+  0xaf, 0xc5, 0xd1, 0x2f, 0xc7, 0xf2, 0xe8, 0x98, 0x7f, 0x64, 0x15, 0x96, 0xe8, 0x83, 0x8c, 0x48,
+  0x33, 0xab, 0x93, 0x9c, 0x59, 0xb9, 0xc3, 0x8f, 0x54, 0x1b, 0x56, 0x68, 0xe1, 0x7d, 0xce, 0x29,
+  0x15, 0xa1, 0x0c, 0xb8, 0x58, 0x8a, 0xe3, 0xb7, 0x21, 0xa2, 0xac, 0x63, 0xb0, 0x55, 0x73, 0x35,
+  0xd2, 0xca, 0xa3, 0x27, 0x25, 0xab, 0xe5, 0x17, 0x5a, 0xa1, 0x56, 0x39, 0x99, 0x16, 0xc2, 0x18,
+  0x65, 0x16, 0x6c, 0x6e, 0x1d, 0x33, 0x10, 0xb6, 0xd6, 0x3d, 0xf9, 0x34, 0x4d, 0xc7, 0x59, 0x49,
+  0x51, 0x20, 0x4c, 0x17, 0x0c, 0xd5, 0x56, 0xa3, 0x85, 0xb3, 0xeb, 0x32, 0xe6, 0x23, 0x66, 0xa0,
+  0xc9, 0x14, 0x13, 0xf2, 0x4a, 0xf2, 0xc9, 0x74, 0x7a, 0x73, 0x39, 0xce, 0xa2, 0x18, 0xb7, 0x95,
+  0x29, 0xd7, 0x81, 0x85, 0x5d, 0x89, 0x67, 0x11, 0xe0, 0xbf, 0x3a, 0x80, 0xa8, 0xc9, 0x4a, 0x2d,
+  0x0a, 0x58, 0x5a, 0x2d, 0x01, 0x8d, 0xc9, 0x8c, 0x63, 0x61, 0x84, 0xb4, 0x46, 0xef, 0x7e, 0xcc,
+  0x71, 0x89, 0xdb, 0x18, 0x35, 0x3a, 0xbf, 0xaf, 0xff, 0xde, 0x0f, 0xa0, 0xd5, 0x8b, 0x41, 0xec,
+  0x57, 0x9d, 0x40, 0xee, 0x5b, 0xb0, 0xf7, 0x62, 0x98, 0xad, 0x43, 0xb0, 0x66, 0xd4, 0x39, 0x81,
+  0x4a, 0xd6, 0xd5, 0xe0, 0xcc, 0x9a, 0x42, 0xab, 0xe2, 0x09, 0x93, 0x15, 0x1b, 0x78, 0xc4, 0x8a,
+  0x27, 0x03, 0x2c, 0x0e, 0xfe, 0x8f, 0xb3, 0x4a, 0xe5, 0x63, 0xcb, 0xad, 0x32, 0xd2, 0x6e, 0x53,
+  0x6d, 0x0b, 0x11, 0x94, 0x35, 0x69, 0x64, 0x49, 0x3f, 0xeb, 0xf3, 0xc9, 0xb9, 0x28, 0x9e, 0x0e,
+  0x70, 0xde, 0xc6, 0xe9, 0xa1, 0x14, 0x4e, 0x04, 0x8b, 0x01, 0xbe, 0xb3, 0x6b, 0x6c, 0x80, 0xc8,
+  0x9d, 0xcf, 0x93, 0x5b, 0xfc, 0x45, 0xc2, 0x7c, 0x9e, 0xf4, 0x6e, 0xe6, 0x0c, 0xf9, 0xc7, 0xaa,
+  0xc6, 0x60, 0xca, 0x33, 0xd4, 0xa2, 0xae, 0x31, 0x50, 0x04, 0xa4, 0xc7, 0x90, 0x81, 0xf1, 0x6b,
+  0x07, 0x51, 0xa9, 0x70, 0x20, 0x91, 0x69, 0xd8, 0x32, 0x9e, 0x09, 0x94, 0x15, 0xd6, 0x39, 0x54,
+  0x4b, 0xdb, 0x50, 0xea, 0x8f, 0x2f, 0x9c, 0x2a, 0xc3, 0xa4, 0xa7, 0x21, 0x30, 0x6f, 0x8b, 0x27,
+  0xfc, 0xe4, 0xc8, 0xb1, 0x2d, 0x7b, 0x84, 0xd9, 0x34, 0xae, 0x93, 0x6f, 0x5b, 0x7f, 0x9a, 0x65,
+  0x3f, 0x3d, 0xbf, 0x49, 0xd6, 0xfa, 0x40, 0x3d, 0xfc, 0x92, 0x6d, 0xfd, 0xb7, 0xc1, 0x59, 0x0f,
+  0x23, 0xf1, 0x81, 0x35, 0xd4, 0xbd, 0x68, 0x0e, 0x00, 0xf1, 0xa4, 0x2d, 0xd6, 0xc4, 0xfb, 0x74,
+  0x01, 0xe1, 0x4a, 0xc7, 0x16, 0x38, 0xdf, 0xdd, 0xc8, 0x64, 0xcf, 0xf3, 0xd6, 0x9c, 0x88, 0x77,
+  0x13, 0x19, 0xf1, 0x1d, 0xb3, 0xc8, 0xce, 0xd6, 0xa4, 0xa1, 0xc9, 0x87, 0x66, 0x2d, 0x9f, 0xd0,
+  0x74, 0xbe, 0x36, 0x05, 0x65, 0xc1, 0x84, 0x94, 0x74, 0xf6, 0xb7, 0x55, 0x5b, 0x25, 0x75, 0x7b,
+  0x0d, 0xd8, 0xf3, 0x41, 0x3e, 0x37, 0x01, 0x56, 0x87, 0xc0, 0x58, 0x5c, 0x11, 0xa0, 0xc6, 0x4e,
+  0x38, 0x56, 0x92, 0x20, 0x1b, 0xcd, 0x34, 0x9e, 0x21, 0xa5, 0x95, 0x22, 0x78, 0x95, 0xe4, 0x48,
+  0xe1, 0x46, 0x47, 0x89, 0x7a, 0xed, 0xa2, 0x9a, 0x78, 0xb1, 0xe2, 0xd1, 0x6d, 0x4a, 0x99, 0xb1,
+  0x9f, 0x19, 0x67, 0x09, 0xc7, 0x4f, 0x23, 0x75, 0x28, 0x8e, 0x52, 0x79, 0xbe, 0x1a, 0xf0, 0x03,
+  0x90, 0x9a, 0x88, 0x08, 0x90, 0x0c, 0x58, 0x3e, 0xc1, 0xa0, 0xdb, 0xfa, 0xa5, 0x1b, 0xa1, 0xd7,
+  0xf0, 0x0a, 0xfa, 0xac, 0xf7, 0x52, 0x59, 0x77, 0x4e, 0x28, 0x15, 0x65, 0x09, 0x46, 0x5e, 0x2c,
+  0x95, 0x96, 0x49, 0x83, 0x8d, 0xb1, 0xbe, 0xf4, 0x2a, 0x46, 0xa0, 0x9b, 0x15, 0x78, 0x8f, 0xc3,
+  0x0b, 0xe1, 0x9a, 0xc2, 0x25, 0xb0, 0xc1, 0xd0, 0xf7, 0x75, 0x6a, 0xe6, 0x12, 0xaa, 0xfc, 0x31,
+  0xbd, 0xbb, 0x4d, 0x4b, 0x9a, 0xf9, 0x95, 0x52, 0x2a, 0x45, 0x10, 0x83, 0xf7, 0x1c, 0x2b, 0xe4,
+  0xae, 0xa3, 0x2b, 0x04, 0xad, 0x38, 0x26, 0xa6, 0xe6, 0x2c, 0x69, 0x07, 0x9c, 0x06, 0xb3, 0x08,
+  0x4b, 0x36, 0x61, 0x47, 0xe4, 0xa5, 0x15, 0xe3, 0x40, 0xb9, 0x12, 0xc5, 0x32, 0xe9, 0x1e, 0x1c,
+  0x85, 0xcb, 0x40, 0x7b, 0x40, 0xd5, 0x0f, 0xfc, 0xe0, 0x44, 0xbd, 0xb5, 0xfb, 0x78, 0xe7, 0x76,
+  0x6d, 0x64, 0x9c, 0xa5, 0x9c, 0x52, 0xc6, 0x02, 0xb5, 0x59, 0x5b, 0x2c, 0xcb, 0x61, 0xca, 0x4d,
+  0xb6, 0x56, 0x03, 0xb6, 0xc1, 0x22, 0xe1, 0x6d, 0x93, 0xb4, 0x6d, 0x88, 0x8c, 0x02, 0x1f, 0xc4,
+  0x0c, 0x67, 0xf9, 0x12, 0x64, 0x4a, 0x47, 0x5e, 0xc3, 0x79, 0x2c, 0x71, 0x12, 0x4b, 0xe3, 0x83,
+  0xc3, 0x76, 0x55, 0xf3, 0x5d, 0xf2, 0x1c, 0xe7, 0xde, 0x29, 0xe3, 0x7e, 0x3d, 0xa3, 0x4e, 0x9c,
+  0x01, 0x1f, 0xb2, 0x60, 0x4b, 0x55, 0xf8, 0x53, 0xf6, 0x0f, 0xc7, 0xcb, 0xce, 0xf0, 0x7f, 0xd9,
+  0xcb, 0x60, 0x70, 0xd6, 0x89, 0xab, 0xd0, 0xd6, 0xc3, 0x8f, 0x07, 0x16, 0xcd, 0xaa, 0x98, 0x0e,
+  0xd1, 0xc0, 0x39, 0xeb, 0x3a, 0x27, 0x4b, 0x82, 0xef, 0x40, 0x5e, 0xd1, 0x3e, 0x06, 0x8d, 0x94,
+  0xac, 0x54, 0x23, 0x5e, 0xdb, 0x51, 0xfb, 0x71, 0xda, 0x92, 0x23, 0xd2, 0x3a, 0x67, 0xaf, 0xc8,
+  0xf9, 0xba, 0x81, 0x51, 0xa3, 0xd3, 0xcb, 0x8d, 0x16, 0xb1, 0xe2, 0x13, 0xd9, 0x12, 0x20, 0x5e,
+  0xff, 0x0e, 0x7b, 0xee, 0x5e, 0x83, 0xc0, 0x1a, 0x78, 0xd0, 0x98, 0x1c, 0x13, 0x2d, 0xcb, 0x29,
+  0x39, 0x07, 0x61, 0xed, 0x0c, 0x1d, 0x26, 0x59, 0x36, 0x90, 0x0d, 0x9f, 0xc6, 0xec, 0xe4, 0x10,
+  0xa7, 0xf1, 0xbd, 0x5a, 0x63, 0x24, 0x33, 0x60, 0x22, 0x30, 0x82, 0x0e, 0xec, 0x24, 0xbe, 0x5b,
+  0x44, 0x11, 0xc0, 0xf9, 0x57, 0xb0, 0x55, 0xd8, 0x74, 0xdb, 0x5d, 0x22, 0xb3, 0xeb, 0x81, 0x79,
+  0x5d, 0x2f, 0x13, 0x9a, 0x2e, 0xf5, 0x7f, 0xdd, 0x59, 0xf5, 0xc4, 0x1a, 0xc6, 0x02, 0xbc, 0xb7,
+  0xdd, 0x4e, 0xa6, 0x61, 0x5b, 0x01, 0x52, 0x83, 0x80, 0x3c, 0xef, 0x67, 0x54, 0xd0, 0x11, 0x91,
+  0xba, 0x3f, 0xc4, 0xc0, 0xf1, 0xed, 0xb4, 0xb4, 0xf2, 0x94, 0xf5, 0xef, 0xef, 0xa6, 0x0f, 0xfd,
+  0x61, 0x8f, 0x5e, 0x1f, 0xa7, 0xfb, 0x60, 0x58, 0x96, 0xb1, 0x29, 0x82, 0xd2, 0x7b, 0x81, 0xfa,
+  0x8e, 0x09, 0x1f, 0x37, 0xe3, 0x62, 0x18, 0xaf, 0x0c, 0x22, 0x61, 0xef, 0x65, 0xd0, 0x4b, 0xf1,
+  0xa2, 0x30, 0x89, 0x03, 0x5f, 0x62, 0x3e, 0x50, 0xcd, 0x0f, 0xaa, 0x58, 0x23, 0x49, 0xed, 0xd3,
+  0x41, 0xa5, 0xe2, 0x1b, 0x06, 0x9f, 0x71, 0x74, 0xd5, 0xf8, 0x78, 0xc8, 0x32, 0x65, 0x7f, 0x12,
+  0xd9, 0x5d, 0x88, 0xce, 0xe2, 0xb5, 0x84, 0xcf, 0x92, 0x6a, 0xcc, 0xbd, 0xbd, 0x18, 0xb1, 0x4e,
+  0x78, 0x35, 0x1e, 0xf4, 0x69, 0x0d, 0x7c, 0x2d, 0x94, 0x06, 0x89, 0xb4, 0x8f, 0xa0, 0xac, 0xe3,
+  0xa7, 0x22, 0x6b, 0x0c, 0x16, 0x91, 0xb0, 0x1a, 0x35, 0x59, 0x27, 0x07, 0xec, 0x8c, 0xa2, 0xa4,
+  0x5f, 0xb1, 0x12, 0x4b, 0xd4, 0x70, 0xb2, 0x82, 0xaf, 0xe4, 0x04, 0x4d, 0x41, 0x76, 0xc1, 0xfb,
+  0x04, 0x1e, 0x1d, 0x8c, 0xb3, 0xe6, 0x22, 0xc4, 0x4b, 0xbb, 0x7a, 0xce, 0x65, 0xf4, 0xa6, 0x9d,
+  0xfc, 0x0f, 0x28, 0x70, 0x75, 0x59, 0xea, 0x0a, 0x00, 0x00,
+};
+static const OTADashAsset wifi_manage_html_asset = { "text/html", "gzip", wifi_manage_html_gz, sizeof(wifi_manage_html_gz), 2794, "b5a71c9e" };
+#else
+static const char wifi_manage_html_text[] = R"rawliteral(<!DOCTYPE HTML>
+<html lang="en">
+<head>
+<meta charset="UTF-8">
+<meta name="viewport" content="width=device-width, initial-scale=1.0">
+<title>WiFi Management</title>
+<link rel="stylesheet" href="/styles.css?v=9c061d01">
+<link rel="stylesheet" href="/theme.css">
+</head>
+<body>
+<div class="container">
+<h1>WiFi Management</h1>
+<div class="wifi-list" id="wifiList">
+<p>Scanning for networks...</p>
+</div>
+<div class="form-group">
+<label for="ssid">SSID</label>
+<input type="text" id="ssid" placeholder="SSID" readonly>
+</div>
+<div class="form-group">
+<label for="password">Password</label>
+<input type="password" id="password" placeholder="Password">
+</div>
+<div class="button-container">
+<button class="button" onclick="saveWifi()">Save</button>
+<button class="button" onclick="window.location.href='/'">Back</button>
+</div>
+<div class="separator"></div>
+<div class="note">
+<h5>Note</h5>
+If the device is not connecting, ensure the credentials are correct.
+</div>
+</div>
+<script>
+let socket = new WebSocket(`ws://${window.location.hostname}/ws`);
+const wifiListContainer = document.getElementById("wifiList");
+const ssidInput = document.getElementById("ssid");
+const passwordInput = document.getElementById("password");
+function addWifiNetwork(network) {
+const wifiItem = document.createElement("div");
+wifiItem.classList.add("wifi-item");
+wifiItem.textContent = network.ssid + " (" + network.rssi + " dBm)";
+wifiItem.onclick = () => {
+ssidInput.value = network.ssid;
+};
+wifiListContainer.appendChild(wifiItem);
+}
+socket.onmessage = function(event) {
+const networks = JSON.parse(event.data);
+wifiListContainer.innerHTML = "";
+if (networks.length > 0) {
+networks.forEach(addWifiNetwork);
+} else {
+wifiListContainer.innerHTML = "<p>No networks found.</p>";
+}
+};
+socket.onopen = function() {
+console.log("WebSocket connection established.");
+socket.send(JSON.stringify({ type: "subscribe", topics: ["scan"] }));
+};
+socket.onclose = function() {
+console.log("WebSocket connection closed.");
+};
+socket.onerror = function(error) {
+console.log("WebSocket Error: " + error);
+};
+function saveWifi() {
+const ssid = ssidInput.value;
+const password = passwordInput.value;
+if (!ssid) {
+alert("Please select a network.");
+return;
+}
+if (password.length < 8) {
+alert("Password must be at least 8 characters.");
+return;
+}
+const formData = new FormData();
+formData.append("ssid", ssid);
+formData.append("password", password);
+fetch('/save-wifi', {
+method: 'POST',
+body: formData  // Sending data as form data, not JSON
+})
+.then(response => {
+if (response.ok) {
+alert("WiFi settings saved. Restarting device...");
+window.location.href = '/';
+} else {
+alert("Failed to save WiFi settings.");
+}
+})
+.catch(error => {
+console.error('Error:', error);
+alert('Error saving WiFi settings.');
+});
+}
+</script>
+</body>
+</html>)rawliteral";
+static const OTADashAsset wifi_manage_html_asset = { "text/html", nullptr, reinterpret_cast<const uint8_t*>(wifi_manage_html_text), sizeof(wifi_manage_html_text) - 1, 2794, "b5a71c9e" };
+#endif
+
+// update_firmware_html: 2666 bytes minified, 1099 bytes gzip
+#if OTA_DASH_GZIP_ASSETS
+static const uint8_t update_firmware_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x56, 0xdb, 0x6e, 0xe3, 0x36,
+  0x10, 0x7d, 0xf7, 0x57, 0x30, 0x02, 0x02, 0x29, 0x6d, 0x22, 0x39, 0x7d, 0x28, 0x50, 0xc4, 0x72,
+  0x81, 0x64, 0x13, 0x24, 0xc0, 0x66, 0x77, 0xb1, 0xeb, 0x45, 0x5b, 0x14, 0x7d, 0xa0, 0xa5, 0x71,
+  0xc4, 0x86, 0x22, 0x55, 0x72, 0x64, 0xaf, 0xb1, 0xc8, 0xbf, 0x77, 0x78, 0x91, 0xe3, 0xd8, 0x9b,
+  0xcb, 0x4b, 0x14, 0x92, 0x73, 0x39, 0x73, 0x78, 0x86, 0xe3, 0xc9, 0xc1, 0xbb, 0x8f, 0x17, 0xb3,
+  0xbf, 0x3e, 0x5d, 0xb2, 0xeb, 0xd9, 0xed, 0xfb, 0xe9, 0x68, 0xd2, 0x60, 0x2b, 0xdd, 0x07, 0x78,
+  0x4d, 0x1f, 0x14, 0x28, 0x61, 0x7a, 0x25, 0x4c, 0xbb, 0xe2, 0x06, 0xd8, 0xd7, 0xae, 0xe6, 0x08,
+  0x93, 0x22, 0x6c, 0x8f, 0x26, 0x2d, 0x20, 0x67, 0x8a, 0xb7, 0x50, 0x26, 0x4b, 0x01, 0xab, 0x4e,
+  0x1b, 0x4c, 0x58, 0xa5, 0x15, 0x82, 0xc2, 0x32, 0x59, 0x89, 0x1a, 0x9b, 0xb2, 0x86, 0xa5, 0xa8,
+  0xe0, 0xc4, 0x2f, 0x8e, 0x99, 0x50, 0x02, 0x05, 0x97, 0x27, 0xb6, 0xe2, 0x12, 0xca, 0xd3, 0x84,
+  0x82, 0x48, 0xa1, 0xee, 0x99, 0x01, 0x59, 0x26, 0x16, 0xd7, 0x12, 0x6c, 0x03, 0x40, 0x51, 0x1a,
+  0x03, 0x8b, 0x32, 0x29, 0xc2, 0x56, 0x5e, 0x59, 0xfb, 0xfb, 0xb2, 0xfc, 0xad, 0x1a, 0xff, 0x7a,
+  0x5a, 0x8f, 0x5f, 0xf7, 0xc2, 0x06, 0x5a, 0x70, 0x4e, 0xce, 0xb2, 0x88, 0xb5, 0xcc, 0x75, 0xbd,
+  0xa6, 0x4f, 0x2d, 0x96, 0xac, 0x92, 0xdc, 0xda, 0x32, 0x71, 0x48, 0xb9, 0x50, 0x60, 0x9c, 0x59,
+  0x73, 0xba, 0x5f, 0x27, 0xed, 0x8d, 0x26, 0x0b, 0x6d, 0x5a, 0x26, 0xea, 0x32, 0xe9, 0xfd, 0xee,
+  0x15, 0x2d, 0x13, 0x06, 0xaa, 0xc2, 0x75, 0x47, 0x75, 0xb7, 0xbd, 0x44, 0xd1, 0x71, 0x83, 0x85,
+  0xb3, 0x3b, 0x21, 0x0b, 0xee, 0xa2, 0x09, 0xd5, 0xf5, 0xc8, 0x82, 0xc9, 0x42, 0x48, 0x48, 0x7c,
+  0x84, 0x45, 0x4c, 0x70, 0xe5, 0x77, 0x02, 0x71, 0xc3, 0x5e, 0xc2, 0x78, 0x55, 0x41, 0x47, 0xbc,
+  0xe5, 0x73, 0xa1, 0x12, 0xaa, 0xed, 0xbf, 0x5e, 0x18, 0xa8, 0x77, 0x82, 0xcd, 0x7b, 0x44, 0x4d,
+  0xc7, 0x4b, 0x2e, 0x7b, 0x5a, 0x06, 0xa4, 0xec, 0x6a, 0x13, 0x24, 0x96, 0x36, 0x98, 0x3d, 0xe2,
+  0x3e, 0x8f, 0x3b, 0x5a, 0x55, 0x52, 0x54, 0xf7, 0xc4, 0x5b, 0x3f, 0x6f, 0x05, 0x86, 0x00, 0xd9,
+  0x91, 0x67, 0xca, 0x95, 0x10, 0x29, 0x72, 0x8e, 0x9d, 0xd1, 0x77, 0x06, 0xac, 0xbd, 0xd8, 0xe6,
+  0x69, 0xf7, 0xf0, 0x9c, 0xff, 0x70, 0x7b, 0x06, 0xdf, 0x30, 0x99, 0x8e, 0x0f, 0x27, 0x05, 0x9d,
+  0xb8, 0xd8, 0x4f, 0x3e, 0x7c, 0xb8, 0xa9, 0x5d, 0xc0, 0xd3, 0x73, 0x5e, 0xdd, 0x4f, 0x0a, 0x4e,
+  0x36, 0xb6, 0x32, 0xa2, 0xc3, 0xe9, 0x68, 0xd1, 0x13, 0xd7, 0x42, 0x2b, 0xf6, 0x14, 0x30, 0xfb,
+  0x3e, 0x5a, 0x72, 0xc3, 0xb6, 0x29, 0x65, 0x25, 0xab, 0x75, 0xd5, 0xb7, 0xa4, 0xbe, 0xfc, 0x0e,
+  0xf0, 0x52, 0x82, 0xfb, 0xf7, 0x7c, 0x7d, 0x53, 0x67, 0xe9, 0xb6, 0x5d, 0x7a, 0x74, 0xe6, 0x7d,
+  0xb7, 0x89, 0x79, 0xc9, 0x77, 0xdb, 0x6e, 0xf0, 0xdd, 0xe3, 0xe6, 0xa5, 0x00, 0x7b, 0xc6, 0xbb,
+  0x51, 0x88, 0xc4, 0xb7, 0xf8, 0x93, 0xd9, 0xae, 0xa7, 0xe3, 0xf9, 0x2d, 0xae, 0xce, 0xce, 0xf9,
+  0x16, 0x05, 0xbb, 0x68, 0xa0, 0xba, 0x67, 0x62, 0xc1, 0x38, 0x73, 0xd2, 0x64, 0xc2, 0x32, 0x0b,
+  0x12, 0x2a, 0x84, 0x7a, 0x44, 0xbb, 0xd9, 0xc1, 0x36, 0x57, 0xb9, 0x33, 0xb1, 0xb9, 0x04, 0x75,
+  0x87, 0x8d, 0x23, 0x9d, 0xfa, 0xd6, 0x60, 0x96, 0x7e, 0x92, 0xc0, 0x2d, 0x44, 0x47, 0x1f, 0x29,
+  0xf6, 0x8e, 0xb3, 0xcf, 0x5d, 0x26, 0x03, 0xd8, 0x1b, 0x75, 0x36, 0x7a, 0x78, 0x92, 0x93, 0x5a,
+  0x73, 0x93, 0x6d, 0x93, 0x9e, 0x33, 0xa7, 0x79, 0xbf, 0x8c, 0x97, 0x2a, 0xe1, 0x03, 0x75, 0x07,
+  0x15, 0xb6, 0x8f, 0xe5, 0xef, 0xf1, 0x3f, 0xb9, 0x6b, 0x9d, 0xb3, 0x01, 0x6c, 0xb0, 0xcd, 0x41,
+  0xd5, 0xf6, 0x0f, 0x81, 0x4d, 0x96, 0xba, 0x60, 0xe9, 0xd1, 0x16, 0xd8, 0x1b, 0x45, 0xed, 0x22,
+  0x62, 0xbe, 0x21, 0x7b, 0xce, 0x76, 0x6b, 0xd8, 0x80, 0xd8, 0xc1, 0xef, 0x21, 0x51, 0x6b, 0xbc,
+  0xa3, 0xe6, 0x26, 0x48, 0x0a, 0x56, 0xec, 0x2a, 0x2e, 0xb3, 0x57, 0x44, 0xe3, 0xec, 0x08, 0x8a,
+  0xe7, 0xfd, 0x5a, 0xd4, 0xe0, 0xeb, 0x0f, 0x47, 0x2c, 0x48, 0x9e, 0x71, 0x55, 0x33, 0xdb, 0xe8,
+  0x95, 0x3f, 0x1a, 0xae, 0x8b, 0xcd, 0xb9, 0x19, 0x6d, 0xeb, 0x2e, 0xf7, 0xcf, 0x5c, 0x5e, 0x0b,
+  0xdb, 0x49, 0xbe, 0x26, 0x14, 0xa9, 0xd2, 0x0a, 0xd2, 0xb3, 0xd1, 0x9e, 0xb6, 0xf6, 0x2d, 0xe7,
+  0x52, 0x57, 0xf7, 0x69, 0xb8, 0x7b, 0x03, 0x2e, 0xf5, 0x9f, 0xb7, 0xef, 0xaf, 0x11, 0xbb, 0xcf,
+  0xf4, 0xc6, 0x80, 0x45, 0xa6, 0xe7, 0xff, 0x3a, 0x06, 0x50, 0xb3, 0x86, 0xd0, 0xc8, 0x80, 0xd2,
+  0x93, 0xd5, 0x77, 0x52, 0xf3, 0xda, 0x33, 0xf0, 0xad, 0x31, 0xb1, 0xf8, 0xa7, 0xde, 0x59, 0xa8,
+  0x6e, 0x66, 0xa8, 0x73, 0x63, 0x79, 0xce, 0x67, 0x53, 0xca, 0x88, 0x1c, 0xf3, 0xb0, 0x97, 0x6b,
+  0xb5, 0x29, 0x90, 0xae, 0x36, 0x36, 0x76, 0x06, 0x4b, 0x62, 0xcd, 0x5d, 0x97, 0xbb, 0x50, 0xbf,
+  0x88, 0x7a, 0xbb, 0xd0, 0x2d, 0xbd, 0x7c, 0x7c, 0x2e, 0x61, 0x68, 0xf7, 0x0e, 0x4c, 0x45, 0xe7,
+  0xee, 0x40, 0x02, 0x3a, 0x81, 0xdc, 0x72, 0x6c, 0x72, 0xa3, 0x7b, 0x55, 0x67, 0x83, 0x2f, 0x65,
+  0x22, 0x71, 0x15, 0x2c, 0x2c, 0x51, 0x23, 0x97, 0x47, 0xec, 0x27, 0x76, 0x3a, 0x1e, 0x1f, 0x3d,
+  0xf2, 0x45, 0xbd, 0x14, 0x99, 0xf2, 0xa3, 0x89, 0x22, 0xed, 0xc6, 0xfe, 0x99, 0xa5, 0x87, 0x5b,
+  0x04, 0xbb, 0x0e, 0xca, 0x91, 0xfe, 0x5c, 0x84, 0x01, 0xf7, 0xac, 0x07, 0x23, 0x36, 0xe2, 0xbb,
+  0xec, 0xaf, 0x34, 0x18, 0xf1, 0x3b, 0x5a, 0x92, 0x37, 0xe9, 0xe9, 0x21, 0xc8, 0xe1, 0x91, 0x6a,
+  0x0a, 0xdf, 0x69, 0x45, 0x52, 0x5c, 0x18, 0xdd, 0xc6, 0x16, 0x31, 0x4b, 0x30, 0x9e, 0x3a, 0xad,
+  0x3c, 0x9d, 0x5b, 0x7c, 0x0d, 0x54, 0xb9, 0x53, 0x8b, 0x1c, 0x7b, 0x62, 0xb3, 0x2c, 0xd9, 0x2f,
+  0x54, 0x1f, 0x9d, 0xbc, 0x80, 0x37, 0x25, 0x0a, 0x22, 0xc0, 0x4b, 0x65, 0x7b, 0x13, 0xb2, 0x3b,
+  0x1b, 0xaf, 0x40, 0xeb, 0x28, 0x3a, 0xa4, 0x09, 0x41, 0x33, 0xdc, 0x57, 0x44, 0xc9, 0x86, 0x16,
+  0xda, 0xcc, 0xc6, 0x28, 0x5e, 0xdb, 0xd3, 0xb4, 0xb2, 0x76, 0xd1, 0xcb, 0x03, 0x36, 0xa3, 0x20,
+  0x61, 0xcc, 0xb3, 0x95, 0x90, 0x92, 0x29, 0x12, 0x33, 0x21, 0x40, 0x9a, 0x8a, 0xbe, 0x93, 0x2c,
+  0xe0, 0x4c, 0xb4, 0xa0, 0x7b, 0xcc, 0x08, 0x7b, 0x39, 0x25, 0x90, 0xa4, 0x48, 0xee, 0xc2, 0xe7,
+  0x34, 0xc2, 0xa9, 0x3a, 0xa7, 0xa1, 0x87, 0x63, 0x97, 0xde, 0x5d, 0xd1, 0x03, 0x03, 0x49, 0x64,
+  0x7c, 0x7f, 0x2e, 0xf7, 0x82, 0x93, 0x34, 0xeb, 0x83, 0xd0, 0xa4, 0x14, 0xfc, 0xeb, 0x8d, 0xf7,
+  0x7f, 0xca, 0x2b, 0x18, 0xa3, 0x8d, 0x8d, 0x0c, 0xfa, 0xc5, 0x2e, 0x85, 0xcf, 0x44, 0xa7, 0xd1,
+  0x4e, 0x6a, 0x42, 0xa0, 0xd9, 0x4b, 0xbd, 0x19, 0xe2, 0xec, 0xe5, 0xf2, 0x99, 0xbe, 0xd0, 0x93,
+  0x13, 0x5a, 0xc5, 0xfd, 0x44, 0x70, 0xa3, 0x3f, 0xa4, 0xeb, 0x40, 0xd1, 0x03, 0xf9, 0xf1, 0xcb,
+  0x2c, 0x3d, 0x66, 0x69, 0x11, 0xc2, 0xd2, 0xbf, 0x68, 0x7a, 0x20, 0x5f, 0x7f, 0x6b, 0xe4, 0x99,
+  0x0d, 0x4f, 0x0a, 0xed, 0x6d, 0x66, 0xdc, 0x26, 0x07, 0xe1, 0x7b, 0xb9, 0xfd, 0x87, 0xa6, 0x7e,
+  0x43, 0xff, 0xef, 0xbc, 0x14, 0xfb, 0xca, 0x4f, 0xc7, 0xaf, 0x08, 0x3d, 0x1d, 0x64, 0xf3, 0xd9,
+  0xe1, 0xfb, 0x91, 0xa4, 0x69, 0xb4, 0x0f, 0x03, 0x7b, 0x33, 0xeb, 0xe3, 0x2f, 0xae, 0xc2, 0xff,
+  0xa6, 0xfc, 0x1f, 0x1c, 0x4f, 0x55, 0x0d, 0x6a, 0x0a, 0x00, 0x00,
+};
+static const OTADashAsset update_firmware_html_asset = { "text/html", "gzip", update_firmware_html_gz, sizeof(update_firmware_html_gz), 2666, "44c05791" };
+#else
+static const char update_firmware_html_text[] = R"rawliteral(<!DOCTYPE HTML>
+<html>
+<head>
+<title>Firmware Update</title>
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<link rel="stylesheet" href="/styles.css?v=9c061d01">
+<link rel="stylesheet" href="/theme.css">
+</head>
+<body>
+<div class="container">
+<h1>Firmware Update</h1>
+<form id="updateForm" enctype="multipart/form-data">
+<input type="file" id="firmwareFile" name="firmware" accept=".bin" required>
+<input type="button" value="Update Firmware" class="button" id="updateButton" onclick="submitUpdate()">
+</form>
+<div id="progressContainer">
+<div id="progressBar">
+<div id="progressText">0%</div>
+</div>
+</div>
+<a href="/" class="button">Back</a>
+<script>
+function submitUpdate() {
+var firmwareFile = document.getElementById('firmwareFile');
+var updateButton = document.getElementById('updateButton');
+var progressContainer = document.getElementById('progressContainer');
+var progressBar = document.getElementById('progressBar');
+var progressText = document.getElementById('progressText');
+// Check if a file is selected
+if (!firmwareFile.files.length) {
+alert('Please select a firmware file.');
+return;
+}
+// Check if the selected file is a .bin file
+var fileName = firmwareFile.files[0].name;
+if (!fileName.endsWith('.bin')) {
+alert('Invalid file selected. Please select a .bin file.');
+return;
+}
+var formData = new FormData(document.getElementById('updateForm'));
+// Hide the update button and show the progress bar
+updateButton.style.display = 'none';
+progressContainer.style.display = 'block';
+// Create XMLHttpRequest object to handle the file upload
+var xhr = new XMLHttpRequest();
+// Track the upload progress
+xhr.upload.onprogress = function(event) {
+if (event.lengthComputable) {
+var percentComplete = Math.round((event.loaded / event.total) * 100);
+progressBar.style.width = percentComplete + '%';
+progressText.textContent = percentComplete + '%'; // Update the percentage text
+}
+};
+// Handle the response from the server
+xhr.onload = function() {
+if (xhr.status === 200) {
+progressText.textContent = '100%'; // Ensure the text shows 100% on completion
+alert('Firmware update successful! The device will now restart.');
+setTimeout(() => {
+location.reload();
+}, 1000);
+} else {
+alert('Firmware update failed!');
+resetUI();
+}
+};
+// Handle errors
+xhr.onerror = function() {
+alert('Firmware update encountered an error!');
+resetUI();
+};
+// Send the form data
+xhr.open('POST', '/update', true);
+xhr.send(formData);
+function resetUI() {
+updateButton.style.display = 'block';
+progressContainer.style.display = 'none';
+progressBar.style.width = '0%';
+progressText.textContent = '0%'; // Reset percentage text
+}
+}
+</script>
+</div>
+</body>
+</html>)rawliteral";
+static const OTADashAsset update_firmware_html_asset = { "text/html", nullptr, reinterpret_cast<const uint8_t*>(update_firmware_html_text), sizeof(update_firmware_html_text) - 1, 2666, "44c05791" };
+#endif
+
+// erase_settings_html: 463 bytes minified, 292 bytes gzip
+#if OTA_DASH_GZIP_ASSETS
+static const uint8_t erase_settings_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x51, 0xb1, 0x4e, 0xc3, 0x30,
+  0x10, 0xdd, 0xfb, 0x15, 0xc6, 0x33, 0x25, 0xed, 0x82, 0x84, 0x64, 0xa7, 0x12, 0x50, 0x89, 0x01,
+  0xd4, 0x4a, 0xed, 0xc2, 0x78, 0xb5, 0xaf, 0xf8, 0x54, 0xc7, 0x8e, 0xe2, 0x4b, 0xaa, 0xfe, 0x3d,
+  0x76, 0x9a, 0x0e, 0xc0, 0xc0, 0xf4, 0x74, 0xa7, 0xf7, 0xde, 0xbd, 0x67, 0xab, 0xbb, 0xd7, 0xcd,
+  0xcb, 0xfe, 0x73, 0xbb, 0x16, 0x6f, 0xfb, 0x8f, 0xf7, 0x5a, 0x39, 0x6e, 0x7c, 0x3d, 0x53, 0x0e,
+  0xc1, 0x66, 0x60, 0x62, 0x8f, 0xf5, 0xba, 0x83, 0x84, 0x62, 0x87, 0xcc, 0x14, 0xbe, 0x92, 0xaa,
+  0xae, 0xdb, 0x99, 0x6a, 0x90, 0x41, 0x04, 0x68, 0x50, 0xcb, 0x81, 0xf0, 0xdc, 0xc6, 0x8e, 0xa5,
+  0x30, 0x31, 0x30, 0x06, 0xd6, 0xf2, 0x4c, 0x96, 0x9d, 0xb6, 0x38, 0x90, 0xc1, 0xf9, 0x38, 0xdc,
+  0x0b, 0x0a, 0xc4, 0x04, 0x7e, 0x9e, 0x0c, 0x78, 0xd4, 0x4b, 0x99, 0x4d, 0x3c, 0x85, 0x93, 0xe8,
+  0xd0, 0x6b, 0x99, 0xf8, 0xe2, 0x31, 0x39, 0xc4, 0xec, 0xe2, 0x3a, 0x3c, 0x6a, 0x59, 0x5d, 0x57,
+  0x0f, 0x26, 0xa5, 0xd5, 0xa0, 0x9f, 0xcc, 0xe2, 0x71, 0x69, 0x17, 0xff, 0xab, 0xd8, 0x61, 0x83,
+  0x45, 0x54, 0x98, 0xd5, 0x54, 0xe5, 0x10, 0xed, 0x25, 0x83, 0xa5, 0x41, 0x18, 0x0f, 0x29, 0x69,
+  0x59, 0x92, 0x02, 0x05, 0xec, 0x0a, 0xcd, 0x2d, 0xff, 0xd4, 0xcc, 0xab, 0x99, 0x3a, 0xc6, 0xae,
+  0x11, 0xb9, 0xa8, 0x8b, 0x56, 0xcb, 0xed, 0x66, 0xb7, 0x97, 0x02, 0x0c, 0x53, 0x0c, 0xf9, 0x0e,
+  0x16, 0x41, 0x11, 0x53, 0x68, 0x7b, 0x16, 0x7c, 0x69, 0xf3, 0x4b, 0xa4, 0xfe, 0xd0, 0x50, 0xce,
+  0x32, 0x80, 0xef, 0xf3, 0xf8, 0xd3, 0x54, 0xde, 0x6e, 0x1f, 0x7a, 0xe6, 0x18, 0xc4, 0xe8, 0x30,
+  0x9f, 0x24, 0x25, 0x6c, 0x39, 0x97, 0x11, 0x6e, 0x55, 0x7e, 0x09, 0x64, 0xfd, 0x0c, 0xe6, 0xa4,
+  0x2a, 0x28, 0xdc, 0x5c, 0xa5, 0xc0, 0x54, 0xac, 0x1a, 0x7f, 0xee, 0x1b, 0xac, 0x36, 0x23, 0x52,
+  0xcf, 0x01, 0x00, 0x00,
+};
+static const OTADashAsset erase_settings_html_asset = { "text/html", "gzip", erase_settings_html_gz, sizeof(erase_settings_html_gz), 463, "694a01e8" };
+#else
+static const char erase_settings_html_text[] = R"rawliteral(<!DOCTYPE HTML><html>
+<head>
+<title>Erase Settings</title>
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<link rel="stylesheet" href="/styles.css?v=9c061d01">
+<link rel="stylesheet" href="/theme.css">
+</head>
+<body>
+<div class="container">
+<h1>Erase Settings</h1>
+<form method="POST" action="/erase">
+<input type="submit" value="Erase Settings" class="button erase-submit">
+</form>
+<a href="/" class="button">Back</a>
+</div>
+</body>
+</html>)rawliteral";
+static const OTADashAsset erase_settings_html_asset = { "text/html", nullptr, reinterpret_cast<const uint8_t*>(erase_settings_html_text), sizeof(erase_settings_html_text) - 1, 463, "694a01e8" };
+#endif
+
+// restart_device_html: 833 bytes minified, 476 bytes gzip
+#if OTA_DASH_GZIP_ASSETS
+static const uint8_t restart_device_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x93, 0xc1, 0x8e, 0x9b, 0x30,
+  0x10, 0x86, 0xef, 0x3c, 0x85, 0xd7, 0x17, 0x88, 0x94, 0x00, 0xb9, 0x54, 0xea, 0x16, 0xa8, 0xd4,
+  0xee, 0x56, 0x3d, 0xb4, 0xda, 0xd5, 0x36, 0x97, 0x1e, 0x1d, 0x7b, 0x28, 0x56, 0x8c, 0x8d, 0xec,
+  0x81, 0x55, 0x54, 0xe5, 0xdd, 0x3b, 0x06, 0x52, 0xa9, 0x69, 0xa5, 0x9e, 0x06, 0x0f, 0xff, 0x7c,
+  0x33, 0x3f, 0x63, 0xaa, 0xbb, 0x87, 0xa7, 0x8f, 0x87, 0xef, 0xcf, 0x8f, 0xec, 0xf3, 0xe1, 0xeb,
+  0x97, 0xa6, 0xea, 0xb0, 0x37, 0x4d, 0x52, 0x75, 0x20, 0x14, 0x05, 0xd4, 0x68, 0xa0, 0x79, 0x81,
+  0x80, 0xc2, 0x23, 0x7b, 0x80, 0x49, 0x4b, 0xa8, 0x8a, 0x25, 0x9b, 0x54, 0x3d, 0xa0, 0x60, 0x56,
+  0xf4, 0x50, 0xf3, 0x49, 0xc3, 0xeb, 0xe0, 0x3c, 0x72, 0x26, 0x9d, 0x45, 0xb0, 0x58, 0xf3, 0x57,
+  0xad, 0xb0, 0xab, 0xd5, 0x5c, 0xb3, 0x9b, 0x0f, 0x5b, 0xa6, 0xad, 0x46, 0x2d, 0xcc, 0x2e, 0x48,
+  0x61, 0xa0, 0xde, 0x73, 0x82, 0x18, 0x6d, 0x4f, 0xcc, 0x83, 0xa9, 0x79, 0xc0, 0xb3, 0x81, 0xd0,
+  0x01, 0x10, 0xa5, 0xf3, 0xd0, 0xd6, 0xbc, 0x58, 0x52, 0xb9, 0x0c, 0xe1, 0xfd, 0x54, 0xbf, 0x95,
+  0xe5, 0x9b, 0xbd, 0x2a, 0xff, 0x5f, 0x85, 0x1d, 0xf4, 0x10, 0x8b, 0xa2, 0xb2, 0x58, 0xad, 0x1c,
+  0x9d, 0x3a, 0x53, 0x50, 0x7a, 0x62, 0xd2, 0x88, 0x10, 0x6a, 0x1e, 0x27, 0x15, 0xda, 0x82, 0x8f,
+  0xb2, 0x6e, 0xff, 0x97, 0x4d, 0x4a, 0x25, 0x55, 0xeb, 0x7c, 0xcf, 0xb4, 0xaa, 0xb9, 0x5f, 0xde,
+  0x7e, 0xa2, 0x73, 0xd4, 0x6b, 0x3b, 0x8c, 0xc8, 0xf0, 0x3c, 0x90, 0xf9, 0xe3, 0x88, 0xe8, 0x2c,
+  0x67, 0x93, 0x30, 0x23, 0x1d, 0xff, 0xe4, 0xf0, 0x6b, 0xbb, 0x45, 0xc5, 0x56, 0xce, 0x2e, 0x8c,
+  0xc7, 0x5e, 0xd3, 0xcc, 0xce, 0x4a, 0xa3, 0xe5, 0x89, 0x8c, 0xcc, 0x89, 0xb5, 0x38, 0xdb, 0xcc,
+  0xb3, 0xc7, 0xee, 0x14, 0xc5, 0xd5, 0xd9, 0x0d, 0x8c, 0x37, 0x1f, 0x84, 0x3c, 0x55, 0x85, 0x20,
+  0x4d, 0x90, 0x5e, 0x0f, 0xd8, 0x24, 0xed, 0x68, 0x25, 0x6a, 0x6a, 0x74, 0xc3, 0x63, 0x3f, 0x93,
+  0x16, 0x50, 0x76, 0x59, 0x5a, 0xac, 0x23, 0xa4, 0x5b, 0xca, 0xd1, 0x0e, 0x3b, 0xa7, 0xee, 0x59,
+  0xfa, 0xfc, 0xf4, 0xed, 0x90, 0x26, 0x97, 0x4d, 0x92, 0xd3, 0xe7, 0xb3, 0x19, 0x69, 0x06, 0x67,
+  0x03, 0xb0, 0xba, 0x21, 0x95, 0x6e, 0xd9, 0xef, 0x4c, 0xee, 0x4e, 0x11, 0x46, 0x0b, 0x24, 0x6c,
+  0xba, 0x98, 0x64, 0x3a, 0x5c, 0x8d, 0x69, 0xfb, 0x23, 0xcf, 0xf3, 0x74, 0xf3, 0x2e, 0x09, 0x80,
+  0x07, 0xdd, 0x83, 0x1b, 0x31, 0xa3, 0xf6, 0x33, 0xc7, 0x38, 0x29, 0xe2, 0x70, 0x39, 0xad, 0xce,
+  0x09, 0x95, 0x91, 0xea, 0xb2, 0x65, 0xfb, 0xb2, 0x2c, 0xe3, 0x13, 0x03, 0x43, 0x0d, 0x6f, 0xd1,
+  0x2b, 0x97, 0xb5, 0x42, 0x1b, 0x50, 0x77, 0x91, 0x7c, 0x99, 0xe7, 0x24, 0x14, 0xd9, 0x01, 0xef,
+  0x9d, 0x5f, 0xe8, 0xb4, 0xd0, 0xe0, 0x0c, 0xe4, 0x73, 0x2a, 0x4b, 0x1f, 0x63, 0xb8, 0x27, 0x97,
+  0xf3, 0x99, 0xca, 0xfe, 0xcd, 0x05, 0x2b, 0xdd, 0x48, 0x77, 0xd6, 0x83, 0x62, 0xc2, 0x2e, 0xe2,
+  0xa5, 0xcb, 0xdc, 0xa9, 0x2a, 0xae, 0x5f, 0xb6, 0x2a, 0xe8, 0xf2, 0xc4, 0xb0, 0x5e, 0xa5, 0x62,
+  0xfe, 0x57, 0x7e, 0x01, 0x46, 0xb0, 0xa1, 0xeb, 0x41, 0x03, 0x00, 0x00,
+};
+static const OTADashAsset restart_device_html_asset = { "text/html", "gzip", restart_device_html_gz, sizeof(restart_device_html_gz), 833, "135b5599" };
+#else
+static const char restart_device_html_text[] = R"rawliteral(<!DOCTYPE HTML><html>
+<head>
+<title>Restart Device</title>
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<link rel="stylesheet" href="/styles.css?v=9c061d01">
+<link rel="stylesheet" href="/theme.css">
+</head>
+<body>
+<div class="container">
+<h1>Restart Device</h1>
+<form id="restartForm">
+<input type="button" value="Restart Device" class="button restart-submit" onclick="submitRestart()">
+</form>
+<a href="/" class="button">Back</a>
+<script>
+function submitRestart() {
+fetch('/restart', {
+method: 'POST'
+})
+.then(response => {
+if (response.ok) {
+alert('Device is restarting...');
+setTimeout(() => {
+location.reload();
+}, 1000);
+} else {
+alert('Device restart failed!');
+}
+})
+.catch(error => {
+console.error('Error:', error);
+alert('Device restart encountered an error!');
+});
+}
+</script>
+</div>
+</body>
+</html>)rawliteral";
+static const OTADashAsset restart_device_html_asset = { "text/html", nullptr, reinterpret_cast<const uint8_t*>(restart_device_html_text), sizeof(restart_device_html_text) - 1, 833, "135b5599" };
+#endif
+
+// about_html: 1136 bytes minified, 547 bytes gzip
+#if OTA_DASH_GZIP_ASSETS
+static const uint8_t about_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x54, 0xcb, 0x6e, 0xdb, 0x30,
+  0x10, 0xbc, 0xfb, 0x2b, 0xb6, 0x3c, 0xf4, 0x54, 0x9b, 0x31, 0x02, 0x14, 0x69, 0x20, 0xa9, 0x4d,
+  0xe3, 0xa4, 0x2e, 0x90, 0x20, 0x41, 0xe2, 0x16, 0xe8, 0xa9, 0x58, 0x89, 0x6b, 0x89, 0x08, 0x45,
+  0x0a, 0xe4, 0xca, 0x86, 0xff, 0xbe, 0xa4, 0x2c, 0xa7, 0x09, 0xd2, 0xa2, 0x8f, 0x13, 0xc1, 0xc1,
+  0xee, 0xec, 0xce, 0x70, 0xa4, 0xec, 0xd5, 0xe2, 0xe6, 0x7c, 0xf5, 0xed, 0xf6, 0x02, 0x96, 0xab,
+  0xeb, 0xab, 0x62, 0x92, 0x35, 0xdc, 0x9a, 0x74, 0x10, 0xaa, 0x78, 0xb0, 0x66, 0x43, 0xc5, 0x59,
+  0xe9, 0x7a, 0x86, 0x9b, 0xd5, 0xd9, 0x74, 0x81, 0xa1, 0xc9, 0xe4, 0x1e, 0x9d, 0x64, 0x2d, 0x31,
+  0x82, 0xc5, 0x96, 0x72, 0xb1, 0xd1, 0xb4, 0xed, 0x9c, 0x67, 0x01, 0x95, 0xb3, 0x4c, 0x96, 0x73,
+  0xb1, 0xd5, 0x8a, 0x9b, 0x5c, 0xd1, 0x46, 0x57, 0x34, 0x1d, 0x2e, 0x6f, 0x40, 0x5b, 0xcd, 0x1a,
+  0xcd, 0x34, 0x54, 0x68, 0x28, 0x9f, 0x8b, 0x48, 0x62, 0xb4, 0x7d, 0x00, 0x4f, 0x26, 0x17, 0x81,
+  0x77, 0x86, 0x42, 0x43, 0x14, 0x59, 0x1a, 0x4f, 0xeb, 0x5c, 0xc8, 0x3d, 0x34, 0xab, 0x42, 0x78,
+  0xbf, 0xc9, 0xdf, 0x55, 0x47, 0x6f, 0xe7, 0xea, 0xe8, 0xcf, 0x5d, 0xdc, 0x50, 0x4b, 0xa9, 0x29,
+  0x55, 0xca, 0x51, 0x4a, 0xe9, 0xd4, 0x2e, 0x1e, 0x4a, 0x6f, 0xa0, 0x32, 0x18, 0x42, 0x2e, 0xd2,
+  0xa6, 0xa8, 0x2d, 0x79, 0xf1, 0x1c, 0x4f, 0x0d, 0x7b, 0xb0, 0x99, 0x17, 0x3f, 0x55, 0xc7, 0xcb,
+  0x24, 0xeb, 0x8a, 0x4b, 0xed, 0xdb, 0x2d, 0x7a, 0x82, 0x2f, 0x9d, 0x42, 0x26, 0x78, 0x0d, 0xe7,
+  0xce, 0xae, 0x75, 0xdd, 0x7b, 0x64, 0xed, 0x2c, 0xa4, 0xe2, 0xd2, 0xa1, 0x57, 0x99, 0xec, 0xd2,
+  0xf8, 0x48, 0xfc, 0x72, 0x6c, 0x34, 0x48, 0x0c, 0x6c, 0x59, 0x60, 0xef, 0x6c, 0x5d, 0x7c, 0x25,
+  0x1f, 0x62, 0xf7, 0x69, 0x26, 0x47, 0x00, 0xe6, 0xb3, 0xf9, 0xec, 0x68, 0xcf, 0xd1, 0x15, 0x67,
+  0xd0, 0x99, 0xbe, 0x9e, 0xa2, 0x55, 0xd3, 0xce, 0xe0, 0x2e, 0xbd, 0x05, 0xc4, 0x4b, 0x32, 0xfb,
+  0xc9, 0x68, 0x75, 0x18, 0x0d, 0x6b, 0xe7, 0xe1, 0xe2, 0xfe, 0x16, 0xf6, 0xee, 0x07, 0xe8, 0x83,
+  0xb6, 0x35, 0x20, 0x6c, 0xa9, 0x8c, 0x6f, 0xc0, 0xe4, 0xd7, 0x58, 0xd1, 0xec, 0xb7, 0x1b, 0x7a,
+  0x52, 0x9a, 0x07, 0xf7, 0x9a, 0xe3, 0x62, 0x41, 0x1b, 0x32, 0xae, 0x23, 0x05, 0x1f, 0x77, 0xd1,
+  0x85, 0xe3, 0x61, 0xa1, 0x49, 0x86, 0xa3, 0xdb, 0x0d, 0x73, 0x17, 0x4e, 0xa5, 0xac, 0x35, 0x37,
+  0x7d, 0x39, 0xab, 0x5c, 0x2b, 0x97, 0xd8, 0x62, 0x38, 0x39, 0x39, 0x11, 0xc0, 0xe8, 0x6b, 0x8a,
+  0x59, 0xf8, 0x5e, 0x1a, 0xb4, 0x0f, 0xe2, 0x51, 0xee, 0x50, 0x01, 0xf7, 0x48, 0xa4, 0x1e, 0x15,
+  0x67, 0x12, 0x8b, 0xac, 0xf4, 0x4f, 0xa8, 0x5b, 0xd4, 0x86, 0xdd, 0x69, 0x93, 0x8a, 0x53, 0x69,
+  0xa4, 0xfc, 0x50, 0x27, 0x30, 0x4d, 0x11, 0xc5, 0xaf, 0xf1, 0x44, 0x33, 0xf9, 0x3b, 0x65, 0x77,
+  0x14, 0x5c, 0xef, 0xa3, 0x3f, 0xff, 0x26, 0x4b, 0x1e, 0x32, 0xf1, 0x52, 0xdf, 0x27, 0xcd, 0xcb,
+  0xbe, 0x84, 0x3b, 0xea, 0x5c, 0xd0, 0xec, 0xfc, 0xee, 0xa5, 0xa8, 0xff, 0x23, 0xbe, 0xd2, 0xa5,
+  0x47, 0xbf, 0x83, 0x85, 0xab, 0xfa, 0x36, 0xa6, 0x67, 0x78, 0xf0, 0x7f, 0x90, 0x7a, 0x15, 0x63,
+  0x60, 0x03, 0x3d, 0x0a, 0xbd, 0xfe, 0xbc, 0x82, 0x11, 0x83, 0x29, 0x5c, 0x7a, 0xa2, 0x21, 0x33,
+  0x5d, 0x8c, 0xa1, 0xb3, 0x68, 0xc6, 0x70, 0xb5, 0x2d, 0xf9, 0x2a, 0x7e, 0xaf, 0x31, 0x3f, 0xf4,
+  0x6c, 0xce, 0x41, 0x8c, 0x14, 0x87, 0x71, 0x65, 0xcf, 0xec, 0xac, 0x28, 0x96, 0xae, 0xa5, 0x71,
+  0xaf, 0x7d, 0xa9, 0x1c, 0x3f, 0x3c, 0x39, 0xfc, 0x59, 0x7e, 0x00, 0x99, 0xae, 0xd4, 0x26, 0x70,
+  0x04, 0x00, 0x00,
+};
+static const OTADashAsset about_html_asset = { "text/html", "gzip", about_html_gz, sizeof(about_html_gz), 1136, "9ada7975" };
+#else
+static const char about_html_text[] = R"rawliteral(<!DOCTYPE HTML>
+<html>
+<head>
+<title>About OTA-Dash</title>
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<link rel="stylesheet" href="/styles.css?v=9c061d01">
+<link rel="stylesheet" href="/theme.css">
+</head>
+<body>
+<div class="container">
+<div class="header">
+<h1>OTA-Dash</h1>
+<p>Firmware Update & Configuration Dashboard</p>
+</div>
+<div class="content">
+<p><strong>Version:</strong> 1.1.0</p>
+<p>A plug-and-play OTA and configuration dashboard for ESP devices using a web interface.</p>
+</div>
+<div class="credits">
+<h3>Developed By</h3>
+<p>
+<a href="https://github.com/Hamas888" target="_blank"><strong>Hamas Saeed</strong></a><br>
+<a href="mailto:hamasaeed888@gmail.com">hamasaeed888@gmail.com</a>
+</p>
+</div>
+<div class="credits">
+<h3>Resources</h3>
+<p>
+<a href="https://github.com/Hamas888/OTA-Dash" target="_blank">GitHub Repository</a><br>
+<a href="https://github.com/Hamas888/OTA-Dash" target="_blank">Library Documentation</a>
+</p>
+</div>
+<div class="credits">
+<h3>License</h3>
+<p>MIT License - Free for personal and commercial use</p>
+</div>
+<a href="/" class="button">Home</a>
+</div>
+</body>
+</html>)rawliteral";
+static const OTADashAsset about_html_asset = { "text/html", nullptr, reinterpret_cast<const uint8_t*>(about_html_text), sizeof(about_html_text) - 1, 1136, "9ada7975" };
+#endif
+
+// app_html: 14846 bytes minified, 5004 bytes gzip
+#if OTA_DASH_GZIP_ASSETS
+static const uint8_t app_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x5b, 0xf9, 0x5a, 0x1b, 0xc9,
+  0x76, 0xff, 0x5f, 0x4f, 0x51, 0x6e, 0x7b, 0x46, 0xd2, 0xb5, 0x68, 0x81, 0xb7, 0x70, 0x01, 0xc9,
+  0xd7, 0x06, 0x13, 0x93, 0x78, 0xe1, 0x33, 0x78, 0x9c, 0x7c, 0x84, 0xc4, 0xad, 0xee, 0x92, 0xd4,
+  0x43, 0x6f, 0xd3, 0x0b, 0x58, 0xc3, 0xe5, 0x9d, 0xf2, 0x0c, 0x79, 0xb2, 0xfc, 0xce, 0xa9, 0xaa,
+  0x56, 0xa9, 0xb5, 0xe0, 0xf1, 0xcc, 0xfc, 0x61, 0xd4, 0x55, 0xa7, 0xce, 0xbe, 0xd5, 0x32, 0x07,
+  0x0f, 0x8e, 0x3e, 0x1e, 0x9e, 0xff, 0xe7, 0xe9, 0x1b, 0xf1, 0xf6, 0xfc, 0xfd, 0xbb, 0x61, 0xeb,
+  0x60, 0x5a, 0xc6, 0x91, 0x88, 0xbc, 0x64, 0x32, 0x70, 0x64, 0xe2, 0xd0, 0x80, 0xf4, 0x02, 0xfc,
+  0x89, 0x65, 0xe9, 0x09, 0x7f, 0xea, 0xe5, 0x85, 0x2c, 0x07, 0xce, 0xe7, 0xf3, 0xe3, 0xad, 0x5d,
+  0x9a, 0x2d, 0xc3, 0x32, 0x92, 0xc3, 0x23, 0x79, 0x1d, 0xfa, 0x52, 0x1c, 0xa6, 0x49, 0x99, 0xa7,
+  0x91, 0x38, 0x4d, 0xf3, 0xd2, 0x8b, 0x0e, 0xfa, 0x6a, 0x52, 0xaf, 0x4d, 0xbc, 0x58, 0x0e, 0x9c,
+  0xeb, 0x50, 0xde, 0x64, 0x98, 0x76, 0x84, 0x0f, 0x60, 0x99, 0x00, 0xd7, 0x4d, 0x18, 0x94, 0xd3,
+  0x41, 0xc0, 0x28, 0xb6, 0xf8, 0xa3, 0x27, 0xc2, 0x24, 0x2c, 0x43, 0x2f, 0xda, 0x2a, 0x7c, 0x2f,
+  0x92, 0x83, 0x1d, 0xa2, 0x14, 0x85, 0xc9, 0x95, 0xc8, 0x65, 0x34, 0x70, 0x8a, 0x72, 0x16, 0xc9,
+  0x62, 0x2a, 0x25, 0xb0, 0x4c, 0x73, 0x39, 0x1e, 0x38, 0x7d, 0x35, 0xe4, 0xfa, 0x45, 0xf1, 0xf2,
+  0x7a, 0xf0, 0x77, 0x7f, 0xfb, 0xc5, 0x4e, 0xb0, 0x7d, 0xff, 0xaa, 0x72, 0x2a, 0x63, 0x49, 0x8b,
+  0x08, 0xb2, 0xaf, 0x05, 0x1d, 0xa5, 0xc1, 0x0c, 0x7f, 0x82, 0xf0, 0x5a, 0xf8, 0x91, 0x57, 0x14,
+  0x03, 0x87, 0x38, 0xf5, 0xc2, 0x44, 0xe6, 0xce, 0xe2, 0x38, 0xc9, 0xe2, 0x88, 0xc0, 0x2b, 0xbd,
+  0x2d, 0xfa, 0x39, 0x70, 0xa6, 0x69, 0x2c, 0x81, 0x3c, 0x0c, 0x02, 0x99, 0x90, 0xe6, 0x76, 0x0c,
+  0x64, 0xc6, 0x0a, 0xd9, 0x22, 0x0a, 0x61, 0x32, 0x71, 0x86, 0x20, 0xb6, 0xa3, 0x71, 0x85, 0x01,
+  0x08, 0x54, 0x45, 0x99, 0xc6, 0xa7, 0xde, 0x44, 0x16, 0x34, 0x87, 0x61, 0x4c, 0x7a, 0x9a, 0xcb,
+  0x87, 0xfd, 0x30, 0x19, 0xa7, 0x8e, 0x41, 0x35, 0xaa, 0xca, 0x32, 0x85, 0x61, 0xb4, 0xca, 0x4f,
+  0x30, 0x77, 0xd0, 0xf7, 0x16, 0xe0, 0x6f, 0xc2, 0x71, 0xb8, 0x04, 0xff, 0xde, 0x4b, 0x80, 0x5f,
+  0x7c, 0x39, 0x39, 0x3e, 0x69, 0xc2, 0x07, 0x72, 0x54, 0x4d, 0x96, 0x16, 0x7c, 0x09, 0xa1, 0x36,
+  0x59, 0x14, 0xe2, 0x88, 0xa6, 0x9b, 0x6b, 0xaa, 0x0c, 0x72, 0xcb, 0xa5, 0x45, 0x9f, 0x79, 0x58,
+  0x1c, 0x87, 0x79, 0x7c, 0xe3, 0xe5, 0xb2, 0xb9, 0x4a, 0xe6, 0x5e, 0xb1, 0xbc, 0xe8, 0x0d, 0x8d,
+  0x8a, 0x33, 0x59, 0x96, 0x50, 0x4e, 0xd1, 0x5c, 0x93, 0xcb, 0xa2, 0xf4, 0xd8, 0x61, 0x16, 0x57,
+  0x7d, 0x52, 0xe3, 0x42, 0x29, 0xa2, 0xb9, 0xca, 0x1b, 0xa5, 0xd5, 0xf2, 0x9a, 0x57, 0x34, 0xaa,
+  0x40, 0x2d, 0x3b, 0x16, 0x32, 0xf3, 0x72, 0xaf, 0x4c, 0xf3, 0xb9, 0xf2, 0xad, 0xd9, 0x24, 0x85,
+  0x9c, 0x64, 0xcd, 0xe7, 0xc3, 0x0f, 0xf8, 0x09, 0xd3, 0x3d, 0x1f, 0xb6, 0x4e, 0xc6, 0x02, 0xce,
+  0x23, 0x94, 0x16, 0xc4, 0xb8, 0x4a, 0xfc, 0x32, 0x4c, 0x13, 0x11, 0x16, 0x49, 0xbb, 0x14, 0x37,
+  0x69, 0x7e, 0x05, 0x49, 0x7a, 0x22, 0xcd, 0x64, 0xc2, 0x70, 0xca, 0xfe, 0xf0, 0x6a, 0x31, 0x4b,
+  0xab, 0x5c, 0x8c, 0xf2, 0xf4, 0xa6, 0x90, 0xf9, 0x9e, 0x00, 0xc3, 0x64, 0x7f, 0x35, 0x7d, 0x94,
+  0xc6, 0xf0, 0x32, 0xe2, 0x81, 0xf8, 0x5b, 0x66, 0x64, 0x9c, 0x82, 0x3c, 0xf9, 0x20, 0x24, 0x96,
+  0x11, 0x70, 0x07, 0x62, 0x34, 0x13, 0xb5, 0xcc, 0xd3, 0xb2, 0xcc, 0x8a, 0xbd, 0x7e, 0x7f, 0x12,
+  0x96, 0xd3, 0x6a, 0xe4, 0xfa, 0x69, 0xdc, 0x7f, 0xeb, 0xc5, 0x5e, 0xb1, 0xbb, 0xbb, 0xeb, 0x08,
+  0x68, 0x6a, 0x42, 0x71, 0xfb, 0x3f, 0x23, 0x84, 0xf6, 0x95, 0x33, 0xe4, 0x19, 0x71, 0xe6, 0x49,
+  0x19, 0x2c, 0x90, 0x5b, 0xa6, 0xba, 0xe4, 0xe4, 0xca, 0x1b, 0x2d, 0x27, 0x5f, 0x74, 0x45, 0x76,
+  0xec, 0xd2, 0x1b, 0x45, 0x92, 0x45, 0x53, 0x61, 0x4d, 0x53, 0x24, 0x18, 0x8f, 0x2f, 0xd8, 0x69,
+  0xc9, 0x44, 0xaf, 0x3d, 0xff, 0x6a, 0x9d, 0x06, 0x96, 0x78, 0x51, 0x9e, 0x6e, 0xf3, 0xf2, 0x25,
+  0x3c, 0x0e, 0x85, 0xf2, 0xf5, 0x18, 0xd9, 0xc5, 0x0a, 0x34, 0x8d, 0x83, 0x96, 0x6c, 0x45, 0x61,
+  0x01, 0xe7, 0x20, 0xfe, 0xe8, 0xf3, 0x1d, 0x7d, 0x0d, 0x57, 0x6a, 0x3c, 0x8f, 0xb7, 0x26, 0x79,
+  0x5a, 0x65, 0x9c, 0x4a, 0xbc, 0x91, 0x8c, 0x04, 0xc6, 0xe0, 0x31, 0x45, 0x18, 0x38, 0xc3, 0xb3,
+  0xb3, 0x93, 0xa3, 0x83, 0x3e, 0x0f, 0x63, 0x3a, 0x4c, 0xb2, 0xaa, 0x14, 0xe5, 0x2c, 0x43, 0x96,
+  0x2b, 0xe5, 0x37, 0x8d, 0x9f, 0x21, 0x45, 0x16, 0x79, 0xbe, 0x9c, 0xa6, 0x51, 0x20, 0xb1, 0x98,
+  0x96, 0x39, 0xc8, 0x49, 0x5e, 0x90, 0x26, 0xd1, 0x6c, 0x8d, 0xa9, 0xd7, 0x10, 0xce, 0x30, 0x0d,
+  0xf7, 0x02, 0xf1, 0x53, 0xfd, 0x6b, 0x35, 0x03, 0x35, 0x9c, 0xf2, 0xaf, 0xfa, 0x6b, 0x81, 0x91,
+  0xd3, 0x1a, 0xd9, 0x2a, 0x1e, 0x94, 0x41, 0xb6, 0x16, 0x92, 0x9f, 0x1a, 0x6b, 0x98, 0x4c, 0xa4,
+  0x89, 0x1f, 0x85, 0xfe, 0x15, 0x84, 0xf5, 0xae, 0xe5, 0x17, 0x28, 0xb4, 0xd3, 0x85, 0x72, 0xf0,
+  0xfb, 0xa0, 0xaf, 0x40, 0x7e, 0xdc, 0xe2, 0x3f, 0x1e, 0x9a, 0xca, 0xf1, 0x10, 0x91, 0x02, 0x50,
+  0x54, 0x6c, 0x12, 0xe9, 0x97, 0x1c, 0x95, 0x32, 0x29, 0xaa, 0x5c, 0x32, 0x90, 0x9f, 0x4b, 0x78,
+  0x0e, 0x55, 0x9a, 0x42, 0x20, 0x5d, 0x01, 0x2c, 0xcf, 0x01, 0xe6, 0xfe, 0x91, 0x78, 0x30, 0x99,
+  0xd0, 0xf6, 0x42, 0x93, 0xff, 0x84, 0xca, 0x87, 0xda, 0x0b, 0xc9, 0xaa, 0x6c, 0x0f, 0xb5, 0xe4,
+  0x18, 0x9f, 0x0e, 0xb8, 0xf1, 0x95, 0xc9, 0xe2, 0x2a, 0x2a, 0x43, 0x48, 0x5b, 0xf6, 0xd9, 0xfa,
+  0x44, 0xc1, 0x69, 0x58, 0x75, 0x1c, 0x46, 0x52, 0x59, 0x74, 0xac, 0x09, 0x1c, 0xf3, 0x88, 0x2a,
+  0xad, 0x66, 0xcc, 0x11, 0x9e, 0xef, 0xcb, 0x0c, 0xd1, 0xee, 0x8e, 0x90, 0x4f, 0xe0, 0x69, 0xbf,
+  0x55, 0xc8, 0xe5, 0x41, 0x03, 0x99, 0xb1, 0xde, 0xb5, 0x17, 0x55, 0xf8, 0x6c, 0x64, 0xee, 0xa6,
+  0x95, 0x2c, 0xbe, 0x5f, 0x2f, 0x99, 0xbd, 0x1a, 0xc5, 0x61, 0xa9, 0x10, 0x90, 0xe9, 0xa1, 0x36,
+  0x12, 0xc1, 0x2a, 0x70, 0x59, 0x9e, 0x4e, 0x90, 0xc7, 0x8b, 0xc3, 0x66, 0x25, 0xb5, 0x27, 0x5f,
+  0x7b, 0x2b, 0x87, 0xcf, 0x29, 0x96, 0x86, 0xdb, 0x3f, 0x35, 0x4c, 0xb2, 0x54, 0x25, 0xff, 0x5c,
+  0x26, 0xd1, 0x95, 0xc9, 0x36, 0x62, 0xb3, 0x2c, 0xb1, 0x0d, 0x37, 0x68, 0x70, 0x11, 0xbe, 0xc1,
+  0x8e, 0x60, 0x02, 0x5b, 0x4a, 0x55, 0x4b, 0xba, 0xe3, 0xa5, 0x4a, 0x75, 0x7f, 0x95, 0x40, 0x75,
+  0xd9, 0xb4, 0x45, 0x6a, 0xd6, 0xcc, 0xfb, 0x44, 0x5a, 0x84, 0x6f, 0x8a, 0xa4, 0x49, 0xac, 0x13,
+  0x4a, 0x2f, 0xfe, 0x6b, 0xc5, 0xd2, 0xbd, 0x8a, 0x2d, 0xd4, 0x41, 0x91, 0x79, 0xc9, 0xfa, 0x4e,
+  0x8b, 0x66, 0x87, 0xaa, 0x89, 0x11, 0xef, 0xd2, 0xda, 0x90, 0x16, 0x91, 0x28, 0x9d, 0xa0, 0xd1,
+  0xcc, 0xa5, 0xd4, 0x6e, 0x8e, 0x6f, 0xee, 0x08, 0x19, 0x2f, 0xb7, 0x8d, 0xd4, 0x03, 0x46, 0x29,
+  0x0a, 0xf6, 0xc3, 0x5d, 0xfe, 0x6f, 0x9f, 0xfa, 0x2f, 0x42, 0x08, 0x87, 0x2e, 0x52, 0x94, 0xba,
+  0x4f, 0xa0, 0x37, 0x13, 0x5b, 0xe2, 0x8b, 0x17, 0x92, 0xf5, 0x29, 0x59, 0x8b, 0x18, 0xce, 0x4b,
+  0x2d, 0x9d, 0xeb, 0xba, 0x9a, 0x8b, 0x7b, 0x52, 0xbd, 0xa1, 0x35, 0x8e, 0xe4, 0xb7, 0xad, 0x20,
+  0xa4, 0x4c, 0x84, 0xa6, 0x62, 0x4f, 0xa0, 0x5b, 0xd8, 0x17, 0x31, 0x2a, 0x78, 0x98, 0x6c, 0x95,
+  0x69, 0xb6, 0x27, 0x76, 0xb6, 0xb3, 0x6f, 0xfb, 0xcc, 0x21, 0x3a, 0x34, 0xbf, 0x54, 0x4c, 0x53,
+  0x53, 0xc0, 0x36, 0x98, 0xa2, 0x79, 0x07, 0x16, 0x2f, 0xcb, 0xa2, 0x19, 0xf2, 0x03, 0x7a, 0x06,
+  0x98, 0xc0, 0xe0, 0xd6, 0x68, 0xf2, 0x70, 0x32, 0x2d, 0x2d, 0x44, 0x69, 0xc6, 0xfd, 0x8b, 0x36,
+  0xfb, 0x0e, 0xf5, 0x64, 0x79, 0x9a, 0x1f, 0xf4, 0xd5, 0xf8, 0x12, 0xc0, 0x13, 0xb4, 0x87, 0x5e,
+  0x9e, 0x40, 0xd2, 0xb5, 0x20, 0x4f, 0x9d, 0xa1, 0x6a, 0x08, 0xd6, 0xcc, 0x3f, 0xd3, 0x2a, 0x5c,
+  0x0b, 0xf0, 0x1c, 0x3c, 0xb3, 0x78, 0xc8, 0x5c, 0xbf, 0xc8, 0x7c, 0x94, 0x16, 0xd2, 0x82, 0xed,
+  0xab, 0xb9, 0xb5, 0x75, 0xb7, 0xf4, 0x28, 0x04, 0x17, 0xca, 0xdd, 0x39, 0x86, 0x84, 0x74, 0x27,
+  0xae, 0xa0, 0xa2, 0x8f, 0xee, 0xac, 0xf4, 0xfe, 0xd6, 0x13, 0x5b, 0x05, 0xea, 0x01, 0xea, 0xcb,
+  0x5a, 0xcd, 0x2d, 0x5a, 0x6d, 0x51, 0x8d, 0x8b, 0xd6, 0xd0, 0x61, 0x51, 0x87, 0x81, 0x1f, 0x49,
+  0x2f, 0x27, 0x97, 0x23, 0xfd, 0x37, 0xd2, 0xe9, 0x26, 0x73, 0x1c, 0xd2, 0x3a, 0xed, 0xab, 0x3f,
+  0x54, 0x40, 0xbf, 0x23, 0x8e, 0x74, 0x7f, 0x5c, 0xc7, 0x91, 0x05, 0x4b, 0xb1, 0xa3, 0x32, 0x34,
+  0x02, 0xe5, 0xe3, 0xf9, 0xab, 0xad, 0x23, 0xaf, 0x98, 0xea, 0xa8, 0xc9, 0x9a, 0xa5, 0x4d, 0xfc,
+  0x4c, 0x31, 0x30, 0x0e, 0x27, 0x15, 0xca, 0x34, 0x59, 0x8f, 0x80, 0x47, 0xa9, 0x47, 0x8d, 0x49,
+  0xb6, 0x92, 0x15, 0xbd, 0xef, 0x73, 0x18, 0xdb, 0x41, 0x81, 0x0d, 0x63, 0x32, 0x21, 0x03, 0x17,
+  0xe4, 0xeb, 0xb0, 0xab, 0x1a, 0x10, 0x2a, 0xfa, 0xc8, 0x94, 0xd7, 0x6a, 0xae, 0x8e, 0x65, 0x85,
+  0x38, 0x1b, 0xbe, 0x82, 0x79, 0xab, 0xc9, 0x96, 0x97, 0x04, 0x5b, 0xb0, 0xf3, 0x4c, 0x80, 0x55,
+  0x81, 0x0f, 0xaa, 0xf5, 0x16, 0x3f, 0x81, 0xe1, 0x87, 0x63, 0xf2, 0xcd, 0xd9, 0xa9, 0xee, 0x0c,
+  0x0a, 0x51, 0x15, 0x14, 0xa9, 0x9e, 0xb8, 0x91, 0x23, 0x74, 0xe6, 0x30, 0xf6, 0x18, 0xce, 0xe2,
+  0xae, 0x65, 0x1b, 0x15, 0x34, 0x2c, 0x39, 0x2f, 0x4c, 0x9f, 0x0e, 0xe7, 0x2d, 0xf8, 0xeb, 0x19,
+  0x54, 0xf3, 0x94, 0x19, 0x6a, 0xfd, 0x58, 0x2f, 0x6e, 0x74, 0xb0, 0xd0, 0x93, 0xeb, 0x31, 0x32,
+  0xeb, 0xc1, 0x28, 0xb7, 0x50, 0x63, 0x8f, 0x10, 0x95, 0xe9, 0xde, 0x94, 0x80, 0x09, 0x14, 0x28,
+  0xff, 0x31, 0xa1, 0x41, 0xa2, 0xe2, 0x0c, 0x57, 0x8f, 0x6b, 0xef, 0xf8, 0x1e, 0xc9, 0x90, 0xb5,
+  0xb1, 0x45, 0x81, 0x7e, 0xfe, 0x98, 0x58, 0x7d, 0xe3, 0x28, 0xcb, 0xf2, 0xfd, 0x6b, 0x58, 0xbe,
+  0xad, 0x46, 0x48, 0x91, 0x59, 0x5a, 0x84, 0x68, 0xe5, 0x66, 0xcb, 0x42, 0xfd, 0x18, 0xe2, 0x77,
+  0xe1, 0x28, 0xf7, 0xf2, 0x99, 0x38, 0x4a, 0xfd, 0x8a, 0x9a, 0x7d, 0x36, 0xf8, 0xb2, 0xa8, 0x1b,
+  0x22, 0xe7, 0x2d, 0x36, 0xec, 0xab, 0x22, 0x07, 0xd5, 0x20, 0xcc, 0x90, 0x5c, 0xfa, 0x7d, 0xf1,
+  0x31, 0xc1, 0xf6, 0x8d, 0x76, 0xce, 0xe4, 0x3e, 0xd4, 0x33, 0xde, 0x4c, 0x29, 0xe1, 0xd7, 0x6e,
+  0xb5, 0x27, 0x28, 0xa0, 0x54, 0xfb, 0x58, 0xdc, 0x84, 0xa5, 0x3f, 0x55, 0xfb, 0x32, 0x02, 0xfd,
+  0xfc, 0xe9, 0x9d, 0x98, 0x02, 0x90, 0xdd, 0xb2, 0x98, 0x12, 0x88, 0x27, 0xc8, 0xeb, 0x80, 0xa0,
+  0x8f, 0x35, 0xa6, 0x2b, 0x4d, 0x93, 0x56, 0x24, 0xb1, 0x6f, 0x2c, 0xf6, 0xf9, 0x2f, 0x21, 0x14,
+  0x03, 0xe1, 0x38, 0xea, 0x33, 0x41, 0x52, 0x3b, 0x93, 0xbf, 0x61, 0x64, 0x5b, 0x0d, 0x40, 0x86,
+  0xf2, 0x24, 0x50, 0xdf, 0x40, 0x51, 0x94, 0x02, 0xfb, 0x4c, 0x2a, 0x77, 0x18, 0xba, 0xbd, 0x33,
+  0x63, 0x28, 0x1f, 0x0a, 0xfd, 0x09, 0xf9, 0x36, 0x92, 0x2a, 0x66, 0x9f, 0x6f, 0x6f, 0xd7, 0x6b,
+  0x14, 0xdb, 0x58, 0xd1, 0xa2, 0x63, 0x8b, 0x3d, 0xac, 0xec, 0xb5, 0x68, 0x6f, 0x87, 0x5f, 0x68,
+  0x4a, 0x4b, 0xda, 0x9e, 0x46, 0xa9, 0x17, 0x50, 0x12, 0x17, 0x98, 0xa2, 0x9c, 0x49, 0x53, 0x48,
+  0x79, 0xa1, 0x5f, 0xec, 0x89, 0x0b, 0xa7, 0xf0, 0xbd, 0xc4, 0xb9, 0xec, 0x19, 0x60, 0xfa, 0xa4,
+  0xe6, 0x9f, 0x80, 0x55, 0xa3, 0xa8, 0x70, 0x72, 0xe3, 0xa3, 0x7e, 0xea, 0x86, 0x41, 0x7d, 0x70,
+  0x25, 0xb7, 0x88, 0x61, 0x12, 0x56, 0xa4, 0xac, 0x47, 0x18, 0x38, 0x3f, 0x11, 0x60, 0x0b, 0x02,
+  0xd5, 0xfb, 0xeb, 0x62, 0x9a, 0xde, 0xfc, 0x02, 0xbe, 0x3b, 0x5d, 0xb0, 0xad, 0xc4, 0xa0, 0xde,
+  0x17, 0x52, 0x44, 0xa9, 0xcf, 0xe6, 0x77, 0x49, 0xdf, 0x6e, 0x2e, 0x39, 0xf3, 0x77, 0xfa, 0xff,
+  0xfd, 0xf0, 0xbf, 0xfa, 0x2f, 0xfb, 0x3d, 0xe8, 0xb2, 0x2b, 0xfe, 0xf9, 0x4f, 0xa1, 0x4e, 0x68,
+  0xf6, 0x5b, 0x5a, 0xc3, 0xac, 0x82, 0x0b, 0xc2, 0x70, 0x29, 0x5e, 0x2a, 0x4c, 0x7b, 0x35, 0x4c,
+  0xa0, 0xbd, 0xca, 0xfd, 0xad, 0x92, 0xf9, 0xec, 0x8c, 0xcb, 0x4d, 0x9a, 0xbf, 0x8a, 0xa2, 0x8e,
+  0xe3, 0x72, 0x3a, 0xed, 0xba, 0x70, 0x89, 0x37, 0x9e, 0x3f, 0xed, 0x60, 0x8e, 0x20, 0xc5, 0x60,
+  0x08, 0xb6, 0xf4, 0x87, 0xab, 0x52, 0x2b, 0xa8, 0x98, 0x01, 0xca, 0xbe, 0x85, 0x2c, 0x79, 0xb1,
+  0x78, 0x30, 0x50, 0xe4, 0xf7, 0x5b, 0x77, 0xdd, 0xfd, 0x16, 0xab, 0x40, 0x09, 0x86, 0x81, 0xb9,
+  0xbc, 0xd6, 0x38, 0x30, 0xc3, 0x1b, 0x89, 0x9c, 0xf2, 0x0f, 0x2d, 0x62, 0xc1, 0x8e, 0xc6, 0x46,
+  0x41, 0xb9, 0x2c, 0x7b, 0xa2, 0x48, 0x05, 0xf5, 0x2f, 0x82, 0xf6, 0x96, 0xa8, 0x32, 0xd8, 0x66,
+  0xc6, 0x70, 0x59, 0x6c, 0x13, 0xf4, 0xae, 0x88, 0xba, 0x16, 0x8d, 0x80, 0xf4, 0xcd, 0xeb, 0xe3,
+  0x16, 0x8a, 0x60, 0xd0, 0xb9, 0xe5, 0x2a, 0x0a, 0x0d, 0xa0, 0x7f, 0xa3, 0x08, 0x18, 0x49, 0xa7,
+  0x57, 0xdb, 0x5b, 0xe9, 0x8a, 0xfe, 0xbd, 0x74, 0xd5, 0x18, 0x29, 0xf4, 0xe2, 0x52, 0x10, 0xff,
+  0xe1, 0x58, 0x74, 0x6c, 0x00, 0xe6, 0x9b, 0x58, 0x5e, 0x1a, 0x54, 0x02, 0x5a, 0x22, 0x6a, 0x27,
+  0xfd, 0x22, 0x47, 0x67, 0xa9, 0x7f, 0x25, 0x4b, 0x96, 0x94, 0x1d, 0x33, 0x01, 0x93, 0xf3, 0xe1,
+  0xaf, 0x37, 0x94, 0x20, 0x1e, 0xdd, 0xde, 0x84, 0x49, 0x90, 0xde, 0xb8, 0x73, 0x7b, 0xa7, 0x45,
+  0x49, 0x96, 0xbb, 0x43, 0x40, 0x7d, 0x05, 0xf2, 0x9b, 0x82, 0x76, 0x3d, 0x48, 0x0b, 0xe7, 0x90,
+  0x85, 0xa2, 0xc8, 0xcb, 0x73, 0x6f, 0x36, 0xaa, 0xc6, 0x63, 0xd4, 0x34, 0x9e, 0x4e, 0x13, 0x3e,
+  0x97, 0x19, 0x08, 0x90, 0x62, 0x8b, 0xf9, 0xaa, 0x89, 0x03, 0xce, 0x49, 0xc7, 0xa9, 0x29, 0x1a,
+  0xce, 0x64, 0xe0, 0x2c, 0x59, 0x48, 0xe3, 0xd1, 0x1d, 0x1e, 0xa1, 0x42, 0x3d, 0x48, 0x4a, 0x8d,
+  0x8f, 0xb4, 0xc1, 0xdf, 0x6c, 0x72, 0xd4, 0x16, 0x78, 0x7d, 0xe2, 0xcb, 0x74, 0x2c, 0x5e, 0x11,
+  0x2f, 0xaf, 0x99, 0x17, 0x12, 0x13, 0x8d, 0x06, 0xf4, 0xfe, 0x09, 0x81, 0x9a, 0x07, 0x85, 0xb5,
+  0x04, 0x24, 0x72, 0x59, 0x56, 0x79, 0x42, 0xba, 0xa2, 0x88, 0xd7, 0x84, 0xf6, 0x5b, 0x25, 0xd2,
+  0xdd, 0x6d, 0x6b, 0x4e, 0xf7, 0xdf, 0xce, 0x3e, 0x7e, 0x70, 0x33, 0x3a, 0x94, 0x5d, 0x5c, 0x7e,
+  0x27, 0xa0, 0x1e, 0xb8, 0x4a, 0x47, 0x12, 0x9d, 0x39, 0x32, 0x62, 0x8d, 0x99, 0x70, 0xc3, 0x82,
+  0xff, 0x76, 0x34, 0xae, 0x2e, 0xc1, 0x51, 0x78, 0x7d, 0x90, 0x25, 0x9d, 0x5f, 0x15, 0xf5, 0x04,
+  0x21, 0x93, 0x11, 0x76, 0x36, 0xb4, 0x56, 0x0f, 0xba, 0x61, 0xc0, 0x1e, 0x5c, 0x25, 0x81, 0x1c,
+  0x63, 0x3f, 0x17, 0x88, 0x9f, 0x7f, 0x36, 0x49, 0xe8, 0x62, 0x0e, 0x73, 0x49, 0x48, 0x57, 0x0c,
+  0x5b, 0xb8, 0x03, 0x44, 0x07, 0xba, 0x88, 0x15, 0x40, 0xec, 0x27, 0x5a, 0xd1, 0x7e, 0x84, 0xee,
+  0xef, 0x7e, 0x8b, 0x05, 0x61, 0xb1, 0x60, 0xb4, 0x8f, 0xa3, 0x5f, 0x69, 0x37, 0x7f, 0x25, 0x67,
+  0x45, 0x47, 0x53, 0x98, 0x07, 0x2d, 0x44, 0x60, 0x5c, 0x86, 0x34, 0xf1, 0x75, 0x2b, 0xd2, 0xab,
+  0x3d, 0x31, 0xf6, 0x20, 0x2e, 0xf2, 0x1a, 0xb5, 0xc0, 0x88, 0x86, 0x23, 0x1b, 0x2b, 0xbb, 0x7b,
+  0x83, 0x69, 0xc5, 0x2c, 0xc6, 0x11, 0x80, 0xe7, 0x61, 0x2c, 0x91, 0xb9, 0x3a, 0x4d, 0xb7, 0xee,
+  0x2d, 0xe7, 0x63, 0xe5, 0x48, 0x56, 0x28, 0x70, 0x10, 0x1a, 0xd5, 0x68, 0x3f, 0x42, 0x24, 0x40,
+  0xb5, 0x50, 0x02, 0x9d, 0x17, 0xcd, 0xce, 0x4a, 0x6a, 0xb9, 0x06, 0xd0, 0x7c, 0x8d, 0xd8, 0xfd,
+  0x78, 0xfa, 0xe6, 0x83, 0x8a, 0x19, 0x97, 0x11, 0xb0, 0x4b, 0x20, 0xf0, 0xc1, 0x59, 0x38, 0xb6,
+  0xec, 0x6b, 0x7c, 0x4a, 0x94, 0x79, 0x25, 0x89, 0xae, 0xfe, 0x64, 0x69, 0xf7, 0x17, 0x43, 0x32,
+  0x8e, 0x51, 0xb1, 0x3a, 0x7e, 0x1c, 0xf4, 0x50, 0xd7, 0x26, 0xc5, 0xdc, 0x87, 0x38, 0x28, 0x4f,
+  0xf3, 0x34, 0x0e, 0xe1, 0x71, 0x1d, 0xa4, 0x90, 0x34, 0xba, 0x96, 0x24, 0x1b, 0x29, 0xda, 0x32,
+  0x0e, 0xed, 0x49, 0x60, 0xaf, 0xc7, 0x8f, 0x55, 0xad, 0xda, 0xb7, 0xb5, 0x8c, 0x71, 0x4a, 0x5e,
+  0x33, 0x82, 0xe6, 0x1f, 0x6e, 0x7a, 0x85, 0xf4, 0xab, 0x91, 0x75, 0xd4, 0x10, 0x65, 0xa7, 0x08,
+  0x18, 0xf7, 0x34, 0xee, 0x0e, 0x11, 0xe6, 0x4d, 0x89, 0x06, 0x60, 0xeb, 0x50, 0x0a, 0x02, 0x97,
+  0xe2, 0xb1, 0x70, 0x20, 0x07, 0x92, 0x1c, 0xcc, 0xae, 0xd3, 0xd1, 0x03, 0x9d, 0xd2, 0x42, 0x54,
+  0xe8, 0x10, 0x72, 0x00, 0x6c, 0x4f, 0xd4, 0x12, 0xed, 0xf1, 0xbf, 0x30, 0x26, 0x89, 0xb6, 0xca,
+  0x9c, 0x4b, 0x54, 0x9d, 0x0f, 0xe9, 0x42, 0x4a, 0x50, 0x79, 0x6c, 0x31, 0x5d, 0x53, 0xbd, 0x54,
+  0x77, 0x1f, 0x9c, 0xc5, 0xc6, 0x12, 0x21, 0xd8, 0x69, 0xf7, 0xbd, 0x2c, 0xec, 0xab, 0x7d, 0x69,
+  0xbb, 0xdb, 0x72, 0x91, 0x6f, 0x13, 0xd2, 0x5c, 0x06, 0x35, 0x49, 0xa5, 0x03, 0xf5, 0xdb, 0xfd,
+  0xb5, 0x48, 0x93, 0x4e, 0xd7, 0x80, 0xe8, 0x33, 0x63, 0x56, 0x69, 0x5d, 0x8b, 0xf8, 0x46, 0x05,
+  0x0a, 0x54, 0x93, 0xea, 0x73, 0x73, 0xa9, 0x6a, 0x6c, 0x88, 0xef, 0x29, 0x5a, 0xb4, 0x81, 0x3a,
+  0x54, 0x0d, 0xfa, 0x12, 0x15, 0x12, 0x56, 0xd9, 0x36, 0xe0, 0x93, 0x6a, 0x00, 0xd4, 0x84, 0xd1,
+  0x97, 0xbd, 0x51, 0x28, 0x5e, 0xcf, 0x4e, 0x82, 0xce, 0xe2, 0x89, 0x36, 0x45, 0x0c, 0xff, 0x5a,
+  0x8d, 0x5e, 0xcd, 0xd5, 0x30, 0xd4, 0xac, 0x51, 0xde, 0xa6, 0x9e, 0x10, 0x19, 0xdf, 0x81, 0x71,
+  0x97, 0x00, 0xd7, 0x50, 0x35, 0x3b, 0x85, 0xee, 0x6a, 0x42, 0x7a, 0xda, 0x48, 0xa1, 0x6e, 0x5d,
+  0x36, 0x49, 0x61, 0xdf, 0xcb, 0x40, 0x08, 0x8d, 0x26, 0xe3, 0x4d, 0xbd, 0x51, 0x23, 0xf7, 0x86,
+  0x96, 0xdf, 0xf3, 0x85, 0x93, 0x85, 0x13, 0xdd, 0x35, 0x62, 0x56, 0xa3, 0xed, 0x38, 0x1e, 0x21,
+  0x22, 0x18, 0x97, 0x5b, 0xd1, 0x0f, 0xaa, 0x7b, 0x31, 0x0d, 0xa9, 0x9e, 0xd2, 0x2a, 0x20, 0xd4,
+  0xa0, 0x56, 0x4e, 0xf5, 0x70, 0x43, 0x28, 0x9a, 0xa5, 0xca, 0x07, 0x79, 0x98, 0x4f, 0x57, 0x95,
+  0x93, 0x43, 0x14, 0xfb, 0xa0, 0x43, 0x0b, 0xba, 0xca, 0x66, 0x77, 0xf0, 0x28, 0xae, 0x06, 0x1d,
+  0x15, 0x33, 0x0b, 0x19, 0x94, 0x87, 0x3a, 0x6d, 0xf6, 0xf1, 0xbd, 0xb6, 0x4e, 0x7a, 0x66, 0xe1,
+  0xdc, 0xb3, 0xe9, 0x94, 0xc2, 0x83, 0x56, 0x4a, 0x59, 0x74, 0x46, 0xf4, 0xaf, 0xc9, 0x4f, 0xfc,
+  0x21, 0x86, 0x03, 0xec, 0x5d, 0x9f, 0xed, 0x3e, 0xff, 0x97, 0x17, 0x5d, 0xa1, 0x13, 0x85, 0x9e,
+  0xe9, 0xd7, 0x13, 0xe8, 0x1a, 0x8e, 0xc3, 0x6f, 0x32, 0xe8, 0x3c, 0xe9, 0xc2, 0xa4, 0x6d, 0xf1,
+  0xfe, 0x75, 0x7b, 0xbf, 0x89, 0xe2, 0xc9, 0xb3, 0x55, 0xeb, 0x31, 0x5a, 0x2f, 0xde, 0x51, 0x8b,
+  0xff, 0x9d, 0x16, 0x6b, 0x48, 0x05, 0x48, 0xa3, 0xfc, 0xab, 0xbd, 0x82, 0xf1, 0xcf, 0x59, 0x89,
+  0xbc, 0xdc, 0x89, 0x99, 0x6d, 0x2a, 0xa8, 0x05, 0x25, 0xe3, 0x80, 0xba, 0x8c, 0xf7, 0xd0, 0xaf,
+  0x3b, 0x8e, 0x52, 0x68, 0x21, 0x56, 0xe4, 0xb6, 0xb7, 0xe7, 0x8e, 0xee, 0xcd, 0x1a, 0x30, 0x66,
+  0x61, 0x5f, 0xec, 0xbe, 0x78, 0x66, 0x41, 0x4e, 0xb1, 0x69, 0x5a, 0x0b, 0xfa, 0xf4, 0x05, 0x20,
+  0xc5, 0x4f, 0xe2, 0xc9, 0x33, 0x03, 0x1e, 0x87, 0x49, 0x45, 0x5c, 0xaf, 0x59, 0xf0, 0x82, 0xc1,
+  0x5f, 0x6c, 0x53, 0x49, 0x51, 0x63, 0x3f, 0x0d, 0xf8, 0xd3, 0x28, 0x87, 0x19, 0x7b, 0xa9, 0xf8,
+  0x83, 0xe4, 0x01, 0x84, 0xdf, 0x13, 0xed, 0x36, 0x29, 0x47, 0x71, 0x82, 0xc1, 0x29, 0x06, 0x1f,
+  0xd7, 0x94, 0x30, 0x10, 0xf3, 0x80, 0xc1, 0x88, 0x81, 0x86, 0xae, 0x4c, 0xbb, 0x6f, 0x9a, 0xcd,
+  0x8f, 0x08, 0x18, 0xee, 0x1a, 0xb9, 0x5f, 0x2a, 0x54, 0x8d, 0xbd, 0x41, 0x6e, 0x42, 0x40, 0x15,
+  0x45, 0x38, 0x8a, 0x90, 0xf9, 0x39, 0xb9, 0xd1, 0xb6, 0x41, 0xdb, 0x4d, 0xf5, 0xa3, 0x05, 0xb9,
+  0x75, 0xca, 0xd5, 0xb7, 0x65, 0xaa, 0x89, 0xba, 0x38, 0xaa, 0x7d, 0x51, 0x95, 0x72, 0x3b, 0x45,
+  0xd2, 0x7c, 0xbb, 0x7b, 0x7f, 0x7e, 0x34, 0x09, 0x92, 0xa9, 0x5a, 0x91, 0xa7, 0x2e, 0x9d, 0x36,
+  0x84, 0xb3, 0x75, 0x17, 0x05, 0xbb, 0x31, 0xb8, 0x1b, 0x22, 0xa1, 0xe7, 0x74, 0xf5, 0x4d, 0x51,
+  0x78, 0x50, 0xe6, 0xc3, 0x83, 0x72, 0x3a, 0x44, 0x81, 0xcb, 0x64, 0x5e, 0x62, 0xa3, 0x8a, 0x0f,
+  0x1a, 0xf8, 0x85, 0x8e, 0xa4, 0xd4, 0x57, 0x1f, 0x30, 0x4e, 0xbd, 0xc7, 0x4a, 0xb9, 0x53, 0xbd,
+  0x68, 0x5d, 0xb4, 0xb1, 0x26, 0xa8, 0xfc, 0x52, 0x50, 0x44, 0xb7, 0xe9, 0x02, 0x7b, 0x9c, 0xba,
+  0x99, 0x1a, 0xbb, 0xec, 0x61, 0xbe, 0x3e, 0x37, 0xd1, 0x47, 0x1d, 0x06, 0xc6, 0x9c, 0xda, 0x33,
+  0x10, 0x62, 0x37, 0x13, 0xef, 0x53, 0x14, 0x24, 0x33, 0xed, 0x63, 0x84, 0x07, 0xe6, 0xf3, 0x87,
+  0x29, 0x34, 0x62, 0xcf, 0xf3, 0xc0, 0x7c, 0xfe, 0x13, 0xc4, 0xb4, 0x29, 0x10, 0x88, 0x19, 0x53,
+  0x50, 0xa7, 0x9f, 0xc5, 0x31, 0xdd, 0x0a, 0xc8, 0xc4, 0x9f, 0xd5, 0x50, 0x59, 0x45, 0x63, 0xef,
+  0xdf, 0xfe, 0xae, 0xa2, 0xf3, 0xed, 0xef, 0xed, 0x39, 0xca, 0x73, 0x19, 0x43, 0x21, 0x1e, 0x0c,
+  0x5c, 0xcb, 0x56, 0xce, 0x87, 0x9a, 0xc1, 0xf9, 0x7f, 0xff, 0x7b, 0xa8, 0xd6, 0xbe, 0xf2, 0x7d,
+  0xba, 0x40, 0x3e, 0x4d, 0x43, 0x64, 0x2c, 0xba, 0xf6, 0x32, 0x8b, 0xbd, 0x8c, 0xbe, 0x96, 0x61,
+  0x4e, 0x4e, 0xc5, 0xab, 0x20, 0xa0, 0x53, 0xff, 0x39, 0xe4, 0xc9, 0xa9, 0xe2, 0xc3, 0x94, 0x5e,
+  0x71, 0x18, 0x85, 0x30, 0xa9, 0x05, 0xa1, 0x07, 0x2e, 0x5b, 0x97, 0x2a, 0xa1, 0x28, 0x79, 0x0c,
+  0x3c, 0x37, 0x2f, 0xb0, 0x93, 0x9b, 0x55, 0xc5, 0xb4, 0x73, 0xd1, 0x3e, 0x53, 0xe7, 0x04, 0x2b,
+  0x68, 0x85, 0x19, 0x76, 0xb3, 0x00, 0x08, 0x27, 0x09, 0x0a, 0xef, 0x19, 0xf6, 0x4e, 0xc9, 0xa4,
+  0x9c, 0x9a, 0xd9, 0x1c, 0x2e, 0xcf, 0xe2, 0x05, 0xaf, 0xe3, 0xf6, 0x25, 0xa7, 0xc7, 0x39, 0x5a,
+  0x32, 0x70, 0x44, 0x3b, 0xfd, 0xb3, 0xf0, 0x77, 0x52, 0x91, 0x9d, 0x2f, 0x95, 0x99, 0x69, 0x96,
+  0x26, 0xbb, 0xca, 0x1b, 0x14, 0x70, 0x26, 0x65, 0x00, 0x68, 0x1b, 0x84, 0x86, 0x74, 0x1a, 0xa2,
+  0x4c, 0xb4, 0x68, 0x8c, 0xb3, 0x2b, 0x8a, 0x97, 0xb5, 0x44, 0x0a, 0x9e, 0xb6, 0xa8, 0xe4, 0x52,
+  0x0a, 0xb3, 0x26, 0xc3, 0x6e, 0x71, 0xc3, 0x22, 0x9a, 0x56, 0xab, 0xde, 0x4a, 0x2f, 0x5b, 0x4b,
+  0x02, 0x7d, 0x44, 0xd6, 0x20, 0x40, 0xf0, 0x2b, 0x45, 0xc6, 0x24, 0xcd, 0x29, 0xd0, 0xf7, 0x61,
+  0x12, 0xc6, 0x55, 0x2c, 0x36, 0x2e, 0x41, 0xb2, 0x3a, 0xae, 0x57, 0xb5, 0xba, 0x96, 0x39, 0xb3,
+  0x22, 0xf7, 0x62, 0x26, 0xdc, 0x30, 0xe7, 0xe9, 0xd9, 0xa7, 0x57, 0xef, 0xd7, 0xb2, 0x3b, 0x5f,
+  0xc6, 0xa6, 0x65, 0xe2, 0xbc, 0x62, 0x1d, 0xc3, 0xa7, 0xb4, 0xa0, 0xdb, 0x34, 0xef, 0x45, 0x5b,
+  0x55, 0x90, 0x7a, 0x95, 0x2e, 0x28, 0xbc, 0xac, 0xe2, 0xdf, 0xbc, 0x86, 0x57, 0x98, 0xce, 0xa0,
+  0xc3, 0x27, 0x0b, 0x3d, 0x75, 0x9e, 0x7d, 0xb9, 0xd0, 0x1c, 0x03, 0x0e, 0x69, 0xc3, 0x64, 0xa0,
+  0x02, 0xb9, 0xe6, 0x53, 0xca, 0x3b, 0x4b, 0x4c, 0xe8, 0x81, 0x43, 0x89, 0xf6, 0xad, 0xd9, 0xc8,
+  0xa8, 0x72, 0x7f, 0x0f, 0x10, 0xd3, 0xfb, 0xeb, 0x4a, 0xbf, 0x39, 0xd7, 0xe1, 0xaa, 0xb0, 0x36,
+  0xb7, 0xd6, 0xf7, 0xe8, 0xdd, 0x46, 0x4a, 0xcd, 0x86, 0x67, 0x40, 0x90, 0x98, 0x4b, 0x91, 0x44,
+  0x6f, 0x2f, 0xf9, 0x52, 0x24, 0x53, 0x99, 0x54, 0xd7, 0x07, 0x3e, 0x4f, 0xea, 0x36, 0xf9, 0xdd,
+  0xcc, 0x6d, 0x83, 0x55, 0x7b, 0xff, 0x6a, 0x28, 0xcd, 0x8f, 0x8a, 0x0c, 0x8f, 0x9b, 0x6a, 0xc4,
+  0x5c, 0x8e, 0xfd, 0x96, 0xf9, 0xbd, 0x20, 0x51, 0x2d, 0x40, 0xc4, 0xd9, 0x41, 0x0c, 0xc5, 0x36,
+  0x0a, 0xb1, 0xe3, 0xd0, 0xc9, 0x11, 0x84, 0xfd, 0x90, 0xd6, 0x10, 0x90, 0x17, 0xfb, 0x63, 0x23,
+  0x66, 0xbd, 0xce, 0xb8, 0x87, 0x1e, 0xb0, 0xdd, 0x82, 0x08, 0x9e, 0x20, 0xb1, 0x6e, 0xe8, 0x1f,
+  0x83, 0xf0, 0xda, 0xb0, 0x46, 0x90, 0xaa, 0x8b, 0x64, 0x26, 0xbd, 0x40, 0xb3, 0xbf, 0x15, 0x62,
+  0x62, 0x01, 0xa8, 0xe1, 0x44, 0x8a, 0xb0, 0x4b, 0x4f, 0x13, 0x78, 0xe7, 0xd4, 0xa1, 0x1e, 0xdb,
+  0x8c, 0xea, 0x34, 0xe7, 0x50, 0x9a, 0xeb, 0x3a, 0x16, 0x12, 0x7d, 0xad, 0x61, 0xed, 0xc2, 0xd7,
+  0x2a, 0x91, 0x1f, 0x3d, 0x74, 0x5d, 0x76, 0xc4, 0x06, 0x41, 0x75, 0x78, 0x62, 0x14, 0x6b, 0x77,
+  0xac, 0x86, 0xd0, 0x0a, 0x0f, 0xac, 0x9f, 0x15, 0xd4, 0x9a, 0x62, 0xde, 0x37, 0x98, 0xd1, 0xe6,
+  0xa0, 0x3e, 0x24, 0xd5, 0xcf, 0x1d, 0x36, 0xee, 0x5b, 0xcc, 0x93, 0x88, 0x7a, 0xad, 0xda, 0x4b,
+  0x02, 0x1d, 0x1f, 0xd8, 0x44, 0x08, 0xba, 0x8e, 0x73, 0x1a, 0x49, 0xba, 0xea, 0xd5, 0xb7, 0x6f,
+  0x5e, 0x2d, 0xa0, 0xb3, 0x70, 0x70, 0x43, 0x2b, 0x0d, 0x3e, 0xe3, 0x2d, 0x07, 0x62, 0xd7, 0xc6,
+  0x63, 0x38, 0x8a, 0xd1, 0xc0, 0x8b, 0x91, 0x14, 0x1e, 0xf6, 0x0f, 0x40, 0x5d, 0x8a, 0x5d, 0x7e,
+  0x6a, 0xe7, 0xa1, 0x7e, 0xe5, 0x45, 0x03, 0xad, 0x12, 0x86, 0xd2, 0xd0, 0x11, 0x9d, 0x2e, 0xa9,
+  0x73, 0xb2, 0x63, 0xfd, 0x49, 0x39, 0xc4, 0x4c, 0x69, 0xed, 0x6a, 0x65, 0xf4, 0x58, 0x67, 0xab,
+  0xa6, 0x6b, 0x99, 0x7b, 0xb5, 0x8a, 0x08, 0x4c, 0x77, 0x66, 0xa4, 0xfc, 0x2d, 0xb2, 0x0d, 0x62,
+  0xee, 0x56, 0xc4, 0xb2, 0x9c, 0xa6, 0xd8, 0x48, 0xb7, 0x4f, 0x3f, 0x9e, 0x9d, 0x63, 0x84, 0x1e,
+  0xcb, 0xed, 0xcd, 0x99, 0xb9, 0x5b, 0xb5, 0xbf, 0x55, 0x1b, 0x85, 0xba, 0x8b, 0x4b, 0xaf, 0x2c,
+  0x0d, 0xf0, 0x73, 0x9d, 0x42, 0x5f, 0x99, 0xb3, 0xa1, 0x03, 0x57, 0xe8, 0x8b, 0x63, 0x4a, 0x19,
+  0xaa, 0x65, 0x43, 0xb2, 0xe0, 0x6d, 0x93, 0x7d, 0xc6, 0x4b, 0xc9, 0xe5, 0x61, 0xdf, 0xa9, 0x4f,
+  0xa7, 0x6a, 0x94, 0xc7, 0x7c, 0x0e, 0x20, 0xca, 0x94, 0xd1, 0x89, 0x05, 0x0a, 0x8c, 0xe6, 0xee,
+  0xc7, 0xd2, 0xa2, 0x42, 0xaf, 0xc6, 0x09, 0x35, 0xb1, 0xb7, 0x88, 0xbc, 0xbd, 0xc2, 0x75, 0x17,
+  0x9e, 0x46, 0xd4, 0xee, 0x6b, 0x3f, 0xdf, 0xd8, 0xe0, 0x8e, 0x6d, 0x1b, 0xae, 0x5d, 0xef, 0x35,
+  0xec, 0x67, 0x18, 0x9b, 0x56, 0xdb, 0x70, 0xf3, 0xd5, 0x4b, 0x6f, 0x31, 0x36, 0xa1, 0x58, 0x02,
+  0x5e, 0xc6, 0xf3, 0xda, 0xfb, 0x2e, 0x0c, 0x00, 0x5b, 0x5e, 0x4b, 0x6f, 0x3b, 0xbe, 0x67, 0x31,
+  0xc1, 0xb5, 0xcd, 0xc1, 0x8e, 0xad, 0x14, 0x97, 0x9e, 0xc4, 0x98, 0x5c, 0x3c, 0xf7, 0xab, 0x76,
+  0x33, 0x42, 0xcd, 0x1a, 0x41, 0xf0, 0x6c, 0xa8, 0xc5, 0x38, 0x5d, 0x81, 0xf4, 0x62, 0xfb, 0x92,
+  0xb7, 0xd7, 0x2e, 0x82, 0xa4, 0xf8, 0x12, 0x96, 0x08, 0x06, 0x3a, 0x59, 0x6e, 0x77, 0x2d, 0x32,
+  0x27, 0x09, 0xb2, 0x04, 0x32, 0x11, 0x2d, 0xa8, 0x6f, 0xab, 0x5d, 0xd1, 0xa4, 0x4e, 0xeb, 0x56,
+  0x51, 0xae, 0xdd, 0x04, 0x32, 0xca, 0xf2, 0xf3, 0x09, 0x7b, 0x88, 0x6d, 0x35, 0x97, 0xaf, 0x89,
+  0xdd, 0x20, 0x2c, 0xf8, 0x86, 0x73, 0x20, 0xda, 0x23, 0x04, 0xc1, 0x15, 0xb6, 0x6d, 0x4b, 0x86,
+  0x59, 0x06, 0x4d, 0xd2, 0x44, 0x5a, 0x90, 0x30, 0x80, 0x86, 0xe1, 0x37, 0xb6, 0x04, 0xb1, 0xfd,
+  0x93, 0x35, 0x4f, 0x3a, 0x6e, 0x54, 0x0a, 0x05, 0x70, 0x77, 0x0f, 0x4b, 0x0d, 0x3a, 0x1b, 0x38,
+  0x32, 0xcc, 0x2b, 0x27, 0xf8, 0x36, 0xcd, 0x75, 0xf6, 0xfa, 0x8f, 0xf7, 0xef, 0xde, 0x96, 0x25,
+  0x36, 0x29, 0xd8, 0x92, 0x14, 0x25, 0xe5, 0x30, 0xcc, 0xa1, 0xaf, 0xa2, 0x0d, 0x29, 0xea, 0x8e,
+  0xc1, 0xbc, 0xfe, 0x9c, 0x5d, 0xd9, 0xff, 0x30, 0x8d, 0xb3, 0x8a, 0x9b, 0xaa, 0x79, 0xa4, 0x61,
+  0x8f, 0xe2, 0x03, 0x82, 0xa6, 0xf8, 0x90, 0x4f, 0x6f, 0xb8, 0x73, 0x2a, 0xcd, 0x1d, 0xb3, 0x1a,
+  0x64, 0xb8, 0xe9, 0x56, 0x9f, 0x65, 0x5a, 0x7a, 0x51, 0x57, 0xfc, 0x8d, 0x7a, 0xf0, 0xee, 0x26,
+  0xfd, 0x35, 0x71, 0xa3, 0x55, 0xbf, 0x47, 0xa1, 0x6b, 0x56, 0xf0, 0x41, 0x37, 0x89, 0x9c, 0x26,
+  0xc4, 0x8b, 0x55, 0x62, 0x49, 0x44, 0x9a, 0x40, 0x42, 0x2c, 0xab, 0x82, 0x4f, 0x7e, 0x9f, 0xd0,
+  0xae, 0xe0, 0x76, 0xa3, 0xd9, 0xc0, 0x38, 0xa1, 0xd5, 0x4e, 0x5a, 0xef, 0x3c, 0xf5, 0x6b, 0xd5,
+  0xa2, 0xe2, 0x2d, 0xd7, 0xb8, 0x8a, 0x1e, 0x88, 0xf3, 0xf9, 0x4b, 0xb9, 0x9b, 0x30, 0x8a, 0x44,
+  0x92, 0xde, 0x98, 0x67, 0x3d, 0xec, 0xab, 0xd6, 0x89, 0xb6, 0x61, 0xa9, 0xce, 0xc2, 0xb9, 0x24,
+  0x66, 0xf9, 0x3e, 0xa4, 0x67, 0x8e, 0x4d, 0x1a, 0xc9, 0x78, 0x89, 0xb6, 0x3a, 0xa4, 0x7d, 0xa0,
+  0xc2, 0x40, 0xfb, 0xfc, 0x82, 0xfc, 0x3a, 0x21, 0xd7, 0x0a, 0x58, 0x83, 0x07, 0x3b, 0x57, 0x58,
+  0x10, 0xd5, 0x11, 0x76, 0xf3, 0x12, 0x95, 0xa3, 0x97, 0xb0, 0x6a, 0x9c, 0xa8, 0x72, 0x1d, 0x53,
+  0xaf, 0xda, 0xfa, 0xe1, 0x32, 0x7e, 0xd2, 0x31, 0xb8, 0xf6, 0x34, 0x3e, 0x2a, 0x5e, 0x28, 0xa3,
+  0xf7, 0xe4, 0x54, 0x82, 0x43, 0x22, 0x58, 0x95, 0xeb, 0xf5, 0x53, 0x2e, 0xeb, 0xf8, 0x97, 0x2f,
+  0x40, 0x57, 0x54, 0xcf, 0x75, 0xd5, 0x52, 0x89, 0x6c, 0xd5, 0x4b, 0xf4, 0x97, 0x6d, 0xf3, 0xac,
+  0x4c, 0xbd, 0x23, 0x0b, 0x5c, 0x3e, 0xef, 0x21, 0x5a, 0x54, 0x86, 0xea, 0x02, 0x6a, 0xa9, 0xf7,
+  0xcf, 0xd5, 0xb8, 0x06, 0xde, 0xb5, 0xea, 0x5e, 0x59, 0xee, 0xea, 0x87, 0x5f, 0x4c, 0x51, 0x77,
+  0xf7, 0xe6, 0x3d, 0xda, 0x9a, 0x03, 0x20, 0x3d, 0xbd, 0x5a, 0x4d, 0x46, 0x4f, 0x0d, 0xa7, 0x38,
+  0xaa, 0x9f, 0x78, 0xe6, 0x75, 0xc7, 0x80, 0x56, 0xa1, 0xbd, 0xbe, 0x55, 0xf8, 0x13, 0x3a, 0xd1,
+  0xc4, 0x34, 0xa5, 0xef, 0xd6, 0xc8, 0xfc, 0x56, 0x9b, 0xd5, 0xc1, 0x9e, 0xa6, 0xaf, 0xa5, 0xd0,
+  0x6b, 0x85, 0x93, 0x64, 0x7e, 0xeb, 0xaa, 0x40, 0xd1, 0x85, 0x8d, 0xf3, 0x34, 0xde, 0x33, 0xd7,
+  0xfe, 0xe8, 0xb1, 0xf8, 0x3a, 0x73, 0x8f, 0x1d, 0x56, 0x20, 0xd4, 0xfc, 0x2a, 0xcf, 0xe1, 0x8f,
+  0xe6, 0x81, 0x92, 0xf2, 0x42, 0x7d, 0xf8, 0x4c, 0xcf, 0x52, 0x0e, 0xe9, 0xa9, 0x1a, 0x1f, 0x4b,
+  0x39, 0x40, 0xe6, 0x3c, 0x1c, 0x8f, 0x9f, 0xe3, 0x3f, 0xfd, 0xd3, 0xf3, 0xb6, 0xb7, 0xe9, 0x27,
+  0x7f, 0xaa, 0xc7, 0x6c, 0xfc, 0xf3, 0x05, 0xff, 0xe7, 0x5c, 0xd6, 0x27, 0x9f, 0xd2, 0x4f, 0x03,
+  0x69, 0x12, 0x34, 0x25, 0x99, 0x23, 0x35, 0xc2, 0x1d, 0xa6, 0x91, 0x6e, 0xf1, 0x02, 0x73, 0x54,
+  0x5f, 0x6c, 0xf6, 0xfb, 0x42, 0x1f, 0xb6, 0x8b, 0x6a, 0xb7, 0x47, 0x47, 0x82, 0x09, 0xe5, 0x3e,
+  0xbe, 0x03, 0xa3, 0x27, 0x13, 0x85, 0xfc, 0x4d, 0x54, 0x4f, 0x9f, 0xf4, 0x44, 0x5c, 0xa8, 0xbf,
+  0xcc, 0x38, 0xc3, 0x02, 0x40, 0xaa, 0x45, 0xde, 0x44, 0xe8, 0xae, 0x99, 0x3f, 0xa9, 0x55, 0x30,
+  0xdf, 0x3b, 0x2f, 0x78, 0x5e, 0x8d, 0x5a, 0xef, 0x19, 0x34, 0xbb, 0x14, 0xc2, 0x7c, 0x57, 0xab,
+  0x39, 0x32, 0x42, 0xd1, 0xc5, 0xf8, 0x51, 0x78, 0xbd, 0x69, 0x03, 0xc0, 0x6f, 0xff, 0xba, 0xea,
+  0x9d, 0x45, 0x3a, 0x1e, 0x23, 0x02, 0x00, 0xbd, 0x83, 0x2d, 0x0b, 0x5f, 0xa1, 0x77, 0xf4, 0xd0,
+  0x63, 0xb1, 0xf3, 0x54, 0x1c, 0xa8, 0x1b, 0x7c, 0x97, 0x4e, 0x9d, 0xdf, 0xd5, 0x0d, 0x88, 0xde,
+  0x9f, 0xf0, 0x7b, 0x0d, 0x9e, 0x06, 0x85, 0xcf, 0x61, 0x52, 0x3e, 0x7d, 0xa2, 0x17, 0xd7, 0x99,
+  0x47, 0x9f, 0x04, 0x17, 0xeb, 0x00, 0x41, 0xe5, 0x59, 0x03, 0x58, 0xa9, 0x69, 0x11, 0x7e, 0x77,
+  0x0e, 0xbe, 0x5b, 0x03, 0xb2, 0x16, 0xd7, 0xc2, 0xfd, 0xbd, 0x86, 0x83, 0x12, 0x15, 0xeb, 0xeb,
+  0x81, 0x77, 0xb6, 0x2d, 0xf2, 0x2b, 0x40, 0x77, 0x5e, 0x58, 0xb0, 0x3b, 0x0d, 0x86, 0xc9, 0x88,
+  0x03, 0xe3, 0x4c, 0xae, 0xfa, 0xcb, 0x99, 0x96, 0x89, 0xa8, 0x1b, 0x68, 0x65, 0xa4, 0x9e, 0xb0,
+  0x74, 0xdb, 0x9b, 0x33, 0xd6, 0x9d, 0x53, 0x47, 0x53, 0x71, 0xff, 0xce, 0x98, 0xa0, 0x1a, 0xf5,
+  0xb0, 0x43, 0x5c, 0xbc, 0x14, 0x5f, 0x2f, 0x1e, 0xdd, 0xe2, 0xd7, 0xdd, 0xa5, 0xf8, 0x4a, 0x9b,
+  0x75, 0x87, 0xce, 0xd6, 0xfe, 0x30, 0x67, 0xf8, 0xa7, 0x66, 0xad, 0xa7, 0x15, 0xd2, 0xad, 0xc9,
+  0xea, 0xdb, 0xb9, 0xaf, 0x0f, 0x1f, 0xdd, 0xc2, 0x03, 0xee, 0x84, 0x78, 0x74, 0x6b, 0xdd, 0x2a,
+  0xd4, 0xe7, 0xa4, 0x4f, 0xbb, 0x77, 0xa2, 0x10, 0xca, 0x48, 0x8f, 0x6e, 0xe9, 0xcf, 0xdd, 0x57,
+  0xd5, 0xdc, 0x5a, 0x01, 0x7c, 0xc1, 0xbf, 0xf9, 0x0a, 0x9d, 0x91, 0xab, 0xde, 0x83, 0xdf, 0xa1,
+  0xd2, 0x7b, 0x97, 0x25, 0x40, 0x7e, 0x2b, 0xa0, 0x1c, 0xbc, 0x79, 0x13, 0x44, 0xf6, 0x98, 0xbf,
+  0x22, 0x22, 0xdf, 0x7c, 0x4c, 0x3e, 0x6d, 0xc4, 0x1a, 0x34, 0xe4, 0xc2, 0x6f, 0x25, 0x98, 0x8d,
+  0xb2, 0xf0, 0xf3, 0x34, 0x8a, 0xce, 0xd3, 0x8c, 0x1f, 0xdb, 0xd8, 0x63, 0x6f, 0x25, 0xbd, 0x5e,
+  0x5c, 0xbc, 0x41, 0x5e, 0x4c, 0x51, 0xd6, 0x11, 0xfd, 0xa4, 0xd8, 0x14, 0x7d, 0xfc, 0x6a, 0x53,
+  0x6f, 0xbd, 0x5d, 0xb4, 0x8d, 0x21, 0xec, 0xda, 0xc3, 0x40, 0xec, 0x65, 0x1d, 0xbe, 0xa9, 0x44,
+  0xab, 0x93, 0x87, 0x31, 0x92, 0x1e, 0xf5, 0xe8, 0x84, 0x5b, 0x8d, 0xce, 0x2f, 0xb7, 0xe9, 0x7a,
+  0x07, 0xda, 0xd8, 0x13, 0xfc, 0x28, 0xe2, 0x04, 0x8e, 0xb1, 0x3e, 0xd4, 0xf9, 0xc5, 0xac, 0xa6,
+  0xd6, 0xa5, 0xc7, 0x4f, 0x7e, 0x54, 0x05, 0xc8, 0xc4, 0xc4, 0xc5, 0x02, 0xfe, 0x07, 0xa5, 0xcb,
+  0x59, 0x5f, 0x6d, 0x03, 0x9c, 0x2d, 0x07, 0xf4, 0x7f, 0x4d, 0xc3, 0x84, 0x99, 0xeb, 0xb5, 0xe4,
+  0xb7, 0x75, 0x0b, 0x57, 0xac, 0xb3, 0x44, 0xa1, 0x67, 0x36, 0x7c, 0x4f, 0xdf, 0xd9, 0xb1, 0x11,
+  0x36, 0x5e, 0x05, 0x2c, 0xbc, 0x46, 0xbd, 0xa7, 0x84, 0x28, 0xda, 0xce, 0xda, 0x2a, 0x31, 0x37,
+  0xd0, 0xfc, 0x69, 0xea, 0xa6, 0x83, 0x1c, 0x95, 0x0d, 0xed, 0xf3, 0xaf, 0x56, 0xdb, 0x7e, 0x06,
+  0x7b, 0xcf, 0xab, 0x68, 0x7e, 0xc8, 0x4a, 0xaf, 0x19, 0xe9, 0x55, 0x1d, 0xf7, 0xb9, 0x28, 0x0c,
+  0x67, 0x25, 0x7c, 0x88, 0x2e, 0x89, 0x80, 0x7c, 0xf9, 0x81, 0x12, 0xda, 0x77, 0x2a, 0xe8, 0xea,
+  0xf1, 0x54, 0x4f, 0x97, 0x4f, 0xae, 0x88, 0x6a, 0x8d, 0x67, 0x12, 0x41, 0x21, 0x51, 0x53, 0xf8,
+  0x32, 0x2a, 0x2c, 0x69, 0x05, 0x9d, 0xfd, 0x41, 0x59, 0x13, 0x6c, 0x3d, 0xe6, 0xf2, 0x78, 0x41,
+  0xf0, 0x86, 0x7a, 0x7a, 0x3a, 0x6c, 0x92, 0x90, 0xa1, 0xe3, 0xd0, 0x35, 0xc8, 0x28, 0x84, 0x63,
+  0xcd, 0xd4, 0x6b, 0x5f, 0x14, 0x3f, 0xbb, 0xd7, 0xae, 0xdf, 0x66, 0xe9, 0x87, 0xe6, 0xe6, 0x3a,
+  0x52, 0x45, 0x67, 0x8d, 0x57, 0xb1, 0x57, 0x5b, 0x63, 0xe3, 0xc3, 0x29, 0xfd, 0x44, 0xaa, 0xee,
+  0x8c, 0xed, 0x8e, 0xc0, 0xbc, 0x21, 0xd0, 0x8f, 0x9a, 0x96, 0xd9, 0xa5, 0xf6, 0xa5, 0x66, 0xd4,
+  0xbc, 0x7e, 0xe3, 0xfe, 0x66, 0xfe, 0xd2, 0x60, 0xbf, 0x35, 0x7f, 0x16, 0xc7, 0xb9, 0xb2, 0xf1,
+  0x9e, 0x6a, 0x9f, 0x5e, 0x4b, 0xeb, 0x07, 0x8d, 0x07, 0x7d, 0xfd, 0xbf, 0x37, 0xf6, 0xe9, 0xff,
+  0xf3, 0x1c, 0xfe, 0x3f, 0x48, 0xad, 0x88, 0x2f, 0xfe, 0x39, 0x00, 0x00,
+};
+static const OTADashAsset app_html_asset = { "text/html", "gzip", app_html_gz, sizeof(app_html_gz), 14846, "1f8174f3" };
+#else
+static const char app_html_text[] = R"rawliteral(<!DOCTYPE HTML>
+<html lang="en">
+<head>
+<meta charset="UTF-8">
+<title>Device Control Portal</title>
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<link rel="stylesheet" href="/styles.css?v=9c061d01">
+<link rel="stylesheet" href="/theme.css">
+</head>
+<body>
+<div class="container">
+<div class="view" data-view="home" hidden>
+<h1 class="portal-heading"></h1>
+<div id="customPages"></div>
+<a href="#/info" class="button">Device Info</a>
+<a href="#/wifi" class="button">Manage WIFI</a>
+<a href="#/debug" class="button">Wireless Debug</a>
+<a href="#/update" class="button">Update Firmware</a>
+<a href="#/erase" class="button">Erase Settings</a>
+<a href="#/restart" class="button">Restart Device</a>
+<a href="#/about" class="button">About</a>
+<div class="separator"></div>
+<div class="note">
+<h5>Note</h5>
+If the update function isn't working, open the portal in your browser: <a id="portalDomain"></a>
+</div>
+<div class="footer">
+Developed by <a href="https://github.com/Hamas888" target="_blank">Hamas Saeed</a>
+</div>
+</div>
+<div class="view" data-view="info" hidden>
+<h1>Device Info</h1>
+<table id="deviceInfo"></table>
+<a href="#/" class="button">Back</a>
+</div>
+<div class="view" data-view="wifi" hidden>
+<h1>WiFi Management</h1>
+<div class="wifi-list" id="wifiList"></div>
+<div class="form-group">
+<label for="ssid">SSID</label>
+<input type="text" id="ssid" placeholder="SSID" readonly>
+</div>
+<div class="form-group">
+<label for="password">Password</label>
+<input type="password" id="password" placeholder="Password">
+</div>
+<div class="button-container">
+<button class="button" onclick="saveWifi()">Save</button>
+<a href="#/" class="button">Back</a>
+</div>
+<div class="separator"></div>
+<div class="note">
+<h5>Note</h5>
+If the device is not connecting, ensure the credentials are correct.
+</div>
+</div>
+<div class="view" data-view="update" hidden>
+<h1>Firmware Update</h1>
+<form id="updateForm" enctype="multipart/form-data">
+<input type="file" id="firmwareFile" name="firmware" accept=".bin" required>
+<input type="button" value="Update Firmware" class="button" id="updateButton" onclick="submitUpdate()">
+</form>
+<div id="progressContainer">
+<div id="progressBar">
+<div id="progressText">0%</div>
+</div>
+</div>
+<a href="#/" class="button">Back</a>
+</div>
+<div class="view" data-view="erase" hidden>
+<h1>Erase Settings</h1>
+<input type="button" value="Erase Settings" class="button erase-submit" onclick="submitErase()">
+<a href="#/" class="button">Back</a>
+</div>
+<div class="view" data-view="restart" hidden>
+<h1>Restart Device</h1>
+<input type="button" value="Restart Device" class="button restart-submit" onclick="submitRestart()">
+<a href="#/" class="button">Back</a>
+</div>
+<div class="view" data-view="debug" hidden>
+<h1><span class="portal-heading"></span> Debug Logs</h1>
+<div class="log-screen" id="logs">
+<span style="color: #888888;">Debug Console Ready - Waiting for messages...</span>
+</div>
+<div class="form-group" style="flex-direction: row; margin-top: 10px;">
+<select id="level" onchange="applyFilter()" style="margin-right: 10px;">
+<option value="1">Error</option>
+<option value="2">Warning</option>
+<option value="3">Info</option>
+<option value="4">Debug</option>
+<option value="5" selected>Verbose</option>
+</select>
+<input type="text" id="tags" placeholder="Tags e.g. wifi, ota*, -sensor" onchange="applyFilter()">
+</div>
+<div style="margin-top: 10px;">
+<button onclick="clearLogs()" class="button" style="margin-right: 10px;">Clear Logs</button>
+<a href="#/" class="button">Back</a>
+</div>
+</div>
+<div class="view" data-view="about" hidden>
+<div class="header">
+<h1>OTA-Dash</h1>
+<p>Firmware Update & Configuration Dashboard</p>
+</div>
+<div class="content">
+<p><strong>Version:</strong> <span id="version"></span></p>
+<p>A plug-and-play OTA and configuration dashboard for ESP devices using a web interface.</p>
+</div>
+<div class="credits">
+<h3>Developed By</h3>
+<p>
+<a href="https://github.com/Hamas888" target="_blank"><strong>Hamas Saeed</strong></a><br>
+<a href="mailto:hamasaeed888@gmail.com">hamasaeed888@gmail.com</a>
+</p>
+</div>
+<div class="credits">
+<h3>Resources</h3>
+<p>
+<a href="https://github.com/Hamas888/OTA-Dash" target="_blank">GitHub Repository</a><br>
+<a href="https://github.com/Hamas888/OTA-Dash" target="_blank">Library Documentation</a>
+</p>
+</div>
+<a href="#/" class="button">Home</a>
+</div>
+</div>
+<script>
+// One page for the whole dashboard: views are switched by the URL hash and share a single /ws connection
+let ws;
+let view = "";
+let nextSeq = 0;
+let lastId = 0;
+const pending = {};
+const reconnectInterval = 5000;
+const views = {
+home: {},
+info: { enter: loadInfo },
+wifi: { topics: ["scan"], enter: scanWifi },
+update: {},
+erase: {},
+restart: {},
+debug: { enter: resumeLogs },
+about: {}
+};
+function showView() {
+const name = location.hash.replace(/^#\/?/, "") || "home";
+view = views[name] ? name : "home";
+document.querySelectorAll(".view").forEach(element => {
+element.hidden = element.dataset.view !== view;
+});
+enterView();
+}
+function enterView() {
+// Each view replaces the topic set, so logs only stream while the debug view resumes them
+send({ type: "subscribe", topics: views[view].topics || [] });
+if (views[view].enter) {
+views[view].enter();
+}
+}
+function connectWebSocket() {
+ws = new WebSocket(`ws://${window.location.hostname}/ws`);
+ws.binaryType = "arraybuffer";
+ws.onopen = () => {
+console.log("WebSocket connected");
+enterView();
+};
+ws.onmessage = (event) => {
+if (event.data instanceof ArrayBuffer) {
+appendRecords(event.data);
+return;
+}
+let message;
+try {
+message = JSON.parse(event.data);
+} catch (e) {
+return;
+}
+if (Array.isArray(message)) {
+showNetworks(message);
+} else if (message.id !== undefined && pending[message.id]) {
+pending[message.id](message);
+delete pending[message.id];
+}
+};
+ws.onclose = () => {
+console.log("WebSocket disconnected");
+Object.keys(pending).forEach(id => {
+pending[id]({ ok: false, error: "Disconnected" });
+delete pending[id];
+});
+setTimeout(connectWebSocket, reconnectInterval);
+};
+}
+function send(message) {
+if (ws && ws.readyState === WebSocket.OPEN) {
+ws.send(JSON.stringify(message));
+return true;
+}
+return false;
+}
+function command(cmd, args) {
+return new Promise((resolve, reject) => {
+const id = ++lastId;
+pending[id] = reply => reply.ok ? resolve(reply.result) : reject(new Error(reply.error || cmd + " failed"));
+if (!send({ id: id, cmd: cmd, args: args })) {
+delete pending[id];
+reject(new Error("Not connected"));
+}
+});
+}
+function loadPortal() {
+fetch('/api/portal')
+.then(response => response.json())
+.then(portal => {
+document.title = portal.title;
+document.querySelectorAll(".portal-heading").forEach(element => {
+element.textContent = portal.title;
+});
+const domain = document.getElementById("portalDomain");
+domain.textContent = portal.domain;
+domain.href = "http://" + portal.domain;
+document.getElementById("version").textContent = portal.version;
+const custom = document.getElementById("customPages");
+portal.pages.forEach(page => {
+const link = document.createElement("a");
+link.className = "button";
+link.href = page.path;
+link.textContent = page.name;
+custom.appendChild(link);
+});
+})
+.catch(error => {
+console.error('Error:', error);
+});
+}
+function formatBytes(bytes) {
+if (bytes >= 1048576) return (bytes / 1048576).toFixed(2) + ' MB';
+if (bytes >= 1024) return (bytes / 1024).toFixed(1) + ' KB';
+return bytes + ' bytes';
+}
+function formatUptime(ms) {
+let seconds = Math.floor(ms / 1000);
+const days = Math.floor(seconds / 86400);
+const hours = Math.floor(seconds / 3600) % 24;
+const minutes = Math.floor(seconds / 60) % 60;
+seconds %= 60;
+return (days ? days + 'd ' : '') + hours + 'h ' + minutes + 'm ' + seconds + 's';
+}
+function loadInfo() {
+// Over the open socket when possible, /api/info returns the same object
+command("info")
+.catch(() => fetch('/api/info').then(response => response.json()))
+.then(info => {
+const table = document.getElementById("deviceInfo");
+table.innerHTML = "<tr><th>Property</th><th>Value</th></tr>";
+const rows = [
+['Product Name', info.product],
+['Firmware Version', info.firmware],
+['Chip Model', info.chipModel],
+['Chip Cores', info.chipCores],
+['Chip Revision', info.chipRevision],
+['CPU Frequency', info.cpuFreqMHz + ' MHz'],
+['Chip Temperature', info.temperature.toFixed(1) + ' °C'],
+['Access Point SSID', info.apSSID],
+['Access Point IP Address', info.apIP],
+['Connected Clients', info.apClients]
+];
+if (info.connected) {
+rows.push(['Station IP Address', info.ip], ['Signal Strength', info.rssi + ' dBm']);
+}
+rows.push(
+['Flash Size', formatBytes(info.flashSize)],
+['Flash Speed', (info.flashSpeed / 1000000) + ' MHz'],
+['Sketch Size', formatBytes(info.sketchSize)],
+['Free Sketch Space', formatBytes(info.sketchSpace)],
+['Heap Size', formatBytes(info.heapSize)],
+['Free Heap', formatBytes(info.freeHeap)],
+['Minimum Free Heap', formatBytes(info.minFreeHeap)]
+);
+if (info.psramSize) {
+rows.push(['PSRAM Size', formatBytes(info.psramSize)], ['Free PSRAM', formatBytes(info.freePsram)]);
+}
+rows.push(['Uptime', formatUptime(info.uptime)]);
+rows.forEach(([name, value]) => {
+const row = table.insertRow();
+row.insertCell().textContent = name;
+row.insertCell().textContent = value;
+});
+})
+.catch(error => {
+console.error('Error:', error);
+});
+}
+function scanWifi() {
+document.getElementById("wifiList").innerHTML = "<p>Scanning for networks...</p>";
+command("scan").catch(error => console.error('Error:', error));
+}
+function showNetworks(networks) {
+const wifiList = document.getElementById("wifiList");
+wifiList.innerHTML = networks.length > 0 ? "" : "<p>No networks found.</p>";
+networks.forEach(network => {
+const wifiItem = document.createElement("div");
+wifiItem.classList.add("wifi-item");
+wifiItem.textContent = network.ssid + " (" + network.rssi + " dBm)";
+wifiItem.onclick = () => {
+document.getElementById("ssid").value = network.ssid;
+};
+wifiList.appendChild(wifiItem);
+});
+}
+function saveWifi() {
+const ssid = document.getElementById("ssid").value;
+const password = document.getElementById("password").value;
+if (!ssid) {
+alert("Please select a network.");
+return;
+}
+if (password.length < 8) {
+alert("Password must be at least 8 characters.");
+return;
+}
+const formData = new FormData();
+formData.append("ssid", ssid);
+formData.append("password", password);
+fetch('/save-wifi', { method: 'POST', body: formData })
+.then(response => {
+if (response.ok) {
+alert("WiFi settings saved. Restarting device...");
+location.hash = "#/";
+} else {
+alert("Failed to save WiFi settings.");
+}
+})
+.catch(error => {
+console.error('Error:', error);
+alert('Error saving WiFi settings.');
+});
+}
+function submitUpdate() {
+const firmwareFile = document.getElementById('firmwareFile');
+const updateButton = document.getElementById('updateButton');
+const progressContainer = document.getElementById('progressContainer');
+const progressBar = document.getElementById('progressBar');
+const progressText = document.getElementById('progressText');
+if (!firmwareFile.files.length) {
+alert('Please select a firmware file.');
+return;
+}
+if (!firmwareFile.files[0].name.endsWith('.bin')) {
+alert('Invalid file selected. Please select a .bin file.');
+return;
+}
+function resetUI() {
+updateButton.style.display = 'block';
+progressContainer.style.display = 'none';
+progressBar.style.width = '0%';
+progressText.textContent = '0%';
+}
+updateButton.style.display = 'none';
+progressContainer.style.display = 'block';
+const xhr = new XMLHttpRequest();
+xhr.upload.onprogress = (event) => {
+if (event.lengthComputable) {
+const percentComplete = Math.round((event.loaded / event.total) * 100);
+progressBar.style.width = percentComplete + '%';
+progressText.textContent = percentComplete + '%';
+}
+};
+xhr.onload = () => {
+if (xhr.status === 200) {
+progressText.textContent = '100%';
+alert('Firmware update successful! The device will now restart.');
+setTimeout(() => {
+location.reload();
+}, 1000);
+} else {
+alert('Firmware update failed!');
+resetUI();
+}
+};
+xhr.onerror = () => {
+alert('Firmware update encountered an error!');
+resetUI();
+};
+xhr.open('POST', '/update', true);
+xhr.send(new FormData(document.getElementById('updateForm')));
+}
+function submitErase() {
+fetch('/erase', { method: 'POST' })
+.then(response => {
+alert(response.ok ? 'Settings erased.' : 'Erasing settings failed!');
+})
+.catch(error => {
+console.error('Error:', error);
+alert('Erasing settings encountered an error!');
+});
+}
+function submitRestart() {
+command("restart")
+.catch(() => fetch('/restart', { method: 'POST' }))
+.then(() => {
+alert('Device is restarting...');
+location.hash = "#/";
+})
+.catch(error => {
+console.error('Error:', error);
+alert('Device restart encountered an error!');
+});
+}
+function resumeLogs() {
+send(Object.assign({ type: "resume", from: nextSeq, binary: true }, currentFilter()));
+}
+const levelColors = ["", "#ff5555", "#ffaa00", "", "#888888", "#666666"];
+const decoder = new TextDecoder();
+function appendRecords(buffer) {
+// version u8, then per record: seq u32, ms u32, level u8, core u8, tag length u8, text length u16, tag, text
+const view = new DataView(buffer);
+const logsDiv = document.getElementById("logs");
+let offset = 1;
+while (offset + 13 <= view.byteLength) {
+const seq = view.getUint32(offset, true);
+const ms = view.getUint32(offset + 4, true);
+const level = view.getUint8(offset + 8);
+const core = view.getUint8(offset + 9);
+const tagLength = view.getUint8(offset + 10);
+const length = view.getUint16(offset + 11, true);
+const tag = decoder.decode(new Uint8Array(buffer, offset + 13, tagLength));
+const line = document.createElement("div");
+line.textContent = (tag ? `[${tag}] ` : "") + decoder.decode(new Uint8Array(buffer, offset + 13 + tagLength, length));
+line.title = `#${seq}  ${(ms / 1000).toFixed(3)} s  core ${core}`;
+if (levelColors[level]) {
+line.style.color = levelColors[level];
+}
+logsDiv.appendChild(line);
+nextSeq = seq + 1;
+offset += 13 + tagLength + length;
+}
+logsDiv.scrollTop = logsDiv.scrollHeight;
+}
+function currentFilter() {
+const tags = document.getElementById("tags").value.split(",").map(t => t.trim()).filter(t => t);
+return {
+level: parseInt(document.getElementById("level").value),
+include: tags.filter(t => !t.startsWith("-")).join(","),
+exclude: tags.filter(t => t.startsWith("-")).map(t => t.substring(1)).join(",")
+};
+}
+function applyFilter() {
+send(Object.assign({ type: "filter" }, currentFilter()));
+}
+function clearLogs() {
+document.getElementById("logs").innerHTML =
+'<div style="color: #888888;">Debug Console Cleared</div>';
+}
+// Stop the log stream while the tab is hidden, resume from the last line seen when it is shown again
+document.addEventListener("visibilitychange", () => {
+if (view !== "debug") return;
+if (document.hidden) {
+send({ type: "subscribe", topics: [] });
+} else {
+resumeLogs();
+}
+});
+window.addEventListener("hashchange", showView);
+loadPortal();
+showView();
+connectWebSocket();
+</script>
+</body>
+</html>)rawliteral";
+static const OTADashAsset app_html_asset = { "text/html", nullptr, reinterpret_cast<const uint8_t*>(app_html_text), sizeof(app_html_text) - 1, 14846, "1f8174f3" };
+#endif
+
+// otadash_css: 5084 bytes minified, 1364 bytes gzip
+#if OTA_DASH_GZIP_ASSETS
+static const uint8_t otadash_css_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x58, 0x0d, 0x6f, 0xdb, 0x36,
+  0x10, 0xfd, 0x2b, 0x5a, 0x86, 0x02, 0x09, 0x10, 0x1a, 0xfe, 0x1c, 0x3c, 0x19, 0x03, 0xe6, 0x24,
+  0x5e, 0x1a, 0xb4, 0xb3, 0x0b, 0xcf, 0x5d, 0x37, 0x14, 0x41, 0x40, 0x59, 0xb4, 0xc5, 0x95, 0x16,
+  0x05, 0x92, 0x8e, 0xed, 0x0a, 0xfe, 0xef, 0xa3, 0x48, 0x51, 0xa2, 0x3e, 0x1c, 0x2b, 0x19, 0x86,
+  0x00, 0xb1, 0x25, 0x91, 0xa7, 0xbb, 0x77, 0xef, 0xee, 0x1e, 0xed, 0x51, 0xff, 0x10, 0x2f, 0x29,
+  0xa1, 0xcc, 0x7d, 0x86, 0xec, 0x12, 0x80, 0x2f, 0x93, 0x9b, 0x4f, 0xe3, 0xfb, 0xc9, 0x1f, 0x4f,
+  0x9f, 0xe6, 0x0f, 0xbf, 0x8f, 0xe7, 0x7f, 0x3f, 0xdd, 0xce, 0x3e, 0xce, 0xe6, 0x57, 0xa3, 0x0d,
+  0x64, 0x6b, 0x1c, 0xba, 0xed, 0x51, 0x04, 0x7d, 0x1f, 0x87, 0x6b, 0xf9, 0xcd, 0xc7, 0x3c, 0x22,
+  0xf0, 0xe0, 0xae, 0x08, 0xda, 0x8f, 0x04, 0xda, 0x0b, 0x00, 0x09, 0x5e, 0x87, 0xee, 0x12, 0x85,
+  0x02, 0xb1, 0xd1, 0x8a, 0x86, 0x02, 0xac, 0xe0, 0x06, 0x93, 0x83, 0x7b, 0x31, 0x66, 0x18, 0x92,
+  0x8b, 0x91, 0x5a, 0x00, 0xb0, 0x40, 0x1b, 0x6e, 0x96, 0xfd, 0xb3, 0xe5, 0x02, 0xaf, 0x0e, 0x60,
+  0x29, 0x97, 0xcb, 0x3b, 0xe6, 0xb6, 0x07, 0x97, 0xdf, 0xd6, 0x8c, 0x6e, 0x43, 0x1f, 0xd4, 0xba,
+  0x77, 0x33, 0xbe, 0xfd, 0x70, 0x3f, 0x9f, 0x7d, 0x9e, 0xde, 0xa5, 0x1e, 0x1e, 0x5b, 0x89, 0x05,
+  0x88, 0x43, 0xc4, 0xe2, 0x1d, 0xf6, 0x45, 0xe0, 0xfe, 0xdc, 0x7e, 0x27, 0xdd, 0xde, 0x03, 0x7d,
+  0x35, 0x68, 0xb7, 0xa3, 0xfd, 0x68, 0x83, 0xc3, 0xf4, 0xba, 0xa7, 0xae, 0x03, 0x84, 0xd7, 0x81,
+  0x70, 0xe1, 0x56, 0xd0, 0x2c, 0xb2, 0x6e, 0xf2, 0xa0, 0x10, 0x9c, 0x0e, 0x1e, 0x08, 0x1a, 0x49,
+  0x33, 0xf2, 0x61, 0xee, 0xdc, 0x0b, 0x6e, 0x75, 0x0d, 0x74, 0x1e, 0xdd, 0x03, 0x1e, 0x40, 0x9f,
+  0xee, 0xdc, 0xb6, 0xd3, 0x76, 0x3a, 0xd2, 0x82, 0xc3, 0xd6, 0x1e, 0xbc, 0x6c, 0x5f, 0xab, 0xbf,
+  0x56, 0xe7, 0xaa, 0x0e, 0x18, 0x8f, 0x32, 0x1f, 0x31, 0xc0, 0xa0, 0x8f, 0xb7, 0xdc, 0x4d, 0x76,
+  0x8d, 0x12, 0x67, 0x80, 0x8f, 0x19, 0x5a, 0x0a, 0x4c, 0x25, 0xd0, 0x94, 0x6c, 0x37, 0xe1, 0xb1,
+  0xe5, 0x6d, 0x85, 0xa0, 0x61, 0x7d, 0x1a, 0x6f, 0x3e, 0x2f, 0x16, 0xb3, 0xe9, 0xd3, 0x62, 0xf2,
+  0xd7, 0x22, 0x4b, 0x65, 0x86, 0x41, 0xe7, 0xa7, 0xc4, 0xaa, 0xfe, 0xae, 0x20, 0xb0, 0xe1, 0x58,
+  0x6e, 0x19, 0x97, 0xf6, 0x22, 0x8a, 0x2d, 0x77, 0xdc, 0x90, 0x86, 0xc8, 0x90, 0x41, 0x45, 0x32,
+  0x94, 0x16, 0x0c, 0x72, 0x9d, 0xae, 0xbc, 0x51, 0x80, 0x0f, 0x87, 0x44, 0x66, 0x04, 0x78, 0x84,
+  0x2e, 0xbf, 0x69, 0x46, 0x70, 0xfc, 0x1d, 0xc9, 0x17, 0x47, 0x75, 0x94, 0x29, 0x86, 0x3c, 0x30,
+  0x6b, 0x7c, 0xb4, 0xa4, 0x0c, 0xaa, 0x90, 0xd5, 0xeb, 0xcf, 0x72, 0x43, 0xc7, 0x6c, 0xc3, 0x8f,
+  0xbf, 0x27, 0xfe, 0xa5, 0xf6, 0xe5, 0x1d, 0x03, 0x1a, 0xc8, 0x49, 0xb3, 0x86, 0x91, 0x46, 0x39,
+  0xc5, 0xa6, 0x2d, 0xe9, 0x53, 0x60, 0x81, 0x42, 0x7f, 0xc7, 0xe4, 0xb2, 0xe4, 0xdf, 0x29, 0xe2,
+  0x56, 0x33, 0x79, 0x6c, 0x85, 0x54, 0xa0, 0xfa, 0xf4, 0x8c, 0x6f, 0x6f, 0x27, 0xd3, 0x2c, 0x33,
+  0x16, 0x40, 0xfd, 0xa8, 0x40, 0xbb, 0xc4, 0x31, 0x6d, 0xc7, 0x09, 0x06, 0x71, 0xfa, 0xc0, 0xa3,
+  0x32, 0x84, 0x4d, 0x82, 0xd3, 0xb1, 0xc5, 0x51, 0x04, 0x25, 0x46, 0xd4, 0x90, 0x5f, 0xb9, 0x9f,
+  0xa6, 0xb3, 0x93, 0xd9, 0x52, 0xdc, 0x76, 0x8a, 0x14, 0x06, 0xe7, 0x1d, 0x3b, 0xb6, 0x56, 0x54,
+  0xbe, 0x9a, 0xd5, 0xc7, 0xf0, 0x7e, 0x32, 0xbe, 0x9b, 0xcc, 0x9f, 0x7e, 0x9b, 0xcd, 0x16, 0xf2,
+  0xa3, 0x1a, 0x4a, 0xa7, 0x18, 0x8a, 0xe2, 0x47, 0x9a, 0x09, 0x15, 0x9a, 0xf4, 0x88, 0x53, 0x82,
+  0x7d, 0xa7, 0x9c, 0xc6, 0xd9, 0xfc, 0x2e, 0x37, 0x98, 0x72, 0x4c, 0x6f, 0x51, 0x21, 0x6b, 0x9f,
+  0x1c, 0x58, 0xef, 0xd5, 0xc7, 0x87, 0xe9, 0x07, 0xb3, 0xb7, 0x8e, 0x45, 0xf9, 0x7e, 0x37, 0xa0,
+  0xcf, 0x32, 0xb6, 0xf2, 0x22, 0x09, 0x0d, 0x62, 0x09, 0x7b, 0x75, 0x67, 0x91, 0xa9, 0x8c, 0x2d,
+  0xc6, 0x12, 0xb4, 0x12, 0x45, 0x50, 0xcb, 0xd9, 0x53, 0xc4, 0x37, 0x19, 0x68, 0x0d, 0x8f, 0xad,
+  0x00, 0x41, 0xdf, 0xbc, 0xa7, 0x40, 0xfb, 0x62, 0x3a, 0xbb, 0x2a, 0xd5, 0x7a, 0xb1, 0x13, 0x74,
+  0xe2, 0xac, 0xf3, 0x36, 0xc9, 0x53, 0xba, 0x2d, 0x32, 0xbb, 0x06, 0x65, 0xcf, 0x64, 0x85, 0x8e,
+  0x1a, 0x67, 0x51, 0x46, 0xce, 0x90, 0x8f, 0x05, 0x8f, 0x5f, 0xd1, 0x8e, 0x7b, 0xa5, 0x8c, 0xa9,
+  0x6c, 0xd5, 0x94, 0xb6, 0x69, 0x22, 0xca, 0xc5, 0xec, 0x4d, 0x4e, 0xd0, 0x8b, 0x2d, 0xb2, 0x34,
+  0x89, 0xba, 0x04, 0x7c, 0x6e, 0x2a, 0x43, 0x61, 0x58, 0x46, 0xa1, 0x67, 0x2f, 0x7b, 0x33, 0x81,
+  0x32, 0x03, 0x67, 0x19, 0x24, 0xa0, 0x47, 0x90, 0x5d, 0x99, 0x45, 0xe6, 0xa8, 0xc7, 0x40, 0x36,
+  0x1a, 0xba, 0x15, 0xee, 0x0a, 0xef, 0x91, 0x6f, 0xf0, 0x92, 0x9e, 0x11, 0x18, 0x71, 0xe4, 0x9a,
+  0x2f, 0x47, 0x11, 0x5c, 0x0b, 0x3f, 0x4e, 0xbb, 0xf1, 0xeb, 0x6a, 0x27, 0x6d, 0x6f, 0x72, 0xab,
+  0x6e, 0x63, 0x1e, 0x43, 0xf0, 0x1b, 0x48, 0xae, 0xf5, 0x4d, 0x75, 0x6d, 0xdf, 0x2d, 0xf3, 0x7d,
+  0x17, 0xc8, 0xbe, 0x06, 0x78, 0x04, 0x97, 0x48, 0x42, 0xc0, 0x36, 0x90, 0x48, 0x77, 0x6a, 0x08,
+  0xfd, 0x06, 0xb6, 0x1c, 0x05, 0x8b, 0xd3, 0x62, 0x19, 0xa8, 0x02, 0xd8, 0xe1, 0x15, 0x06, 0x04,
+  0x73, 0x61, 0xc3, 0x56, 0x08, 0x24, 0x99, 0xed, 0xe9, 0x96, 0xae, 0x1a, 0xcb, 0x49, 0x12, 0x56,
+  0x84, 0xee, 0xc0, 0x41, 0x4f, 0xb0, 0x6a, 0xd3, 0xb1, 0x06, 0x71, 0x32, 0xaa, 0xfa, 0x35, 0x93,
+  0xb8, 0x58, 0x8c, 0xbd, 0x76, 0x85, 0xbb, 0xc3, 0x06, 0xdd, 0xb3, 0x46, 0x9d, 0xa8, 0x78, 0x92,
+  0xb1, 0x10, 0x97, 0x06, 0x6b, 0x21, 0xa6, 0x6c, 0x42, 0xa9, 0xb7, 0x37, 0x4b, 0xaf, 0x65, 0xdb,
+  0x25, 0x90, 0x0b, 0xb0, 0x0c, 0x30, 0x31, 0x14, 0x31, 0xa6, 0x34, 0x63, 0xf3, 0x85, 0x9a, 0xb1,
+  0x6f, 0x49, 0x94, 0x6c, 0x49, 0x79, 0x25, 0x75, 0xad, 0x39, 0x55, 0xe8, 0x5f, 0x2b, 0x49, 0x0f,
+  0x90, 0x98, 0x8e, 0xaa, 0xb4, 0xcf, 0xc2, 0x1b, 0x94, 0x85, 0x56, 0xbd, 0xc0, 0x21, 0xd0, 0x43,
+  0xa4, 0xc9, 0xfc, 0x34, 0xb6, 0xce, 0xc9, 0x0d, 0xab, 0x79, 0xdb, 0x43, 0x14, 0x87, 0xd1, 0x56,
+  0x7c, 0x15, 0x87, 0x08, 0xfd, 0x72, 0x91, 0xac, 0xbe, 0x78, 0xbc, 0xb6, 0x6f, 0x45, 0x90, 0xf3,
+  0xa4, 0x2c, 0x2e, 0x1e, 0xed, 0x90, 0xde, 0x56, 0x89, 0x43, 0x43, 0xc7, 0xb2, 0x30, 0x29, 0x91,
+  0xad, 0x0a, 0xaf, 0x52, 0x02, 0xb6, 0x5b, 0x7c, 0xeb, 0x6d, 0xb0, 0xf4, 0xb5, 0xcc, 0x2b, 0xbb,
+  0xc5, 0xe4, 0x1d, 0x58, 0x2b, 0xa8, 0xaa, 0x60, 0x2b, 0x81, 0x55, 0x6d, 0xd7, 0x0d, 0x05, 0x43,
+  0xc7, 0x44, 0x5a, 0xbb, 0xc8, 0x96, 0xa1, 0xb5, 0xd2, 0xae, 0x56, 0x37, 0x5a, 0x82, 0xb5, 0xff,
+  0x82, 0x60, 0xad, 0xd3, 0x93, 0x75, 0xd2, 0xcf, 0x06, 0x6f, 0x85, 0x09, 0x92, 0xd0, 0xd5, 0xd4,
+  0xa0, 0x9b, 0x40, 0xe3, 0x43, 0x1e, 0xa0, 0x4a, 0x4a, 0xcb, 0xa1, 0x56, 0xc1, 0xd2, 0x1e, 0x76,
+  0xd5, 0x11, 0xa3, 0x98, 0x96, 0x63, 0xeb, 0x19, 0xa3, 0x5d, 0x7c, 0x4a, 0x63, 0xd6, 0x9c, 0x03,
+  0x4e, 0x88, 0xfe, 0xc4, 0xcc, 0xd7, 0x00, 0xfb, 0x3e, 0x0a, 0x1f, 0x63, 0x63, 0x43, 0x55, 0xf9,
+  0x8f, 0x11, 0xa3, 0x6b, 0x86, 0x38, 0xbf, 0x2d, 0x1d, 0x88, 0x6c, 0xbe, 0x76, 0x4f, 0xf1, 0xb5,
+  0x1c, 0x9c, 0x6d, 0x7a, 0x14, 0x51, 0x8e, 0x95, 0x17, 0x0c, 0x11, 0x99, 0xb5, 0x67, 0x74, 0x4a,
+  0xd8, 0xe5, 0x58, 0xe4, 0xee, 0xdc, 0x40, 0xe3, 0x48, 0x2e, 0x4d, 0xd5, 0x9e, 0xaa, 0x55, 0xc1,
+  0x60, 0x98, 0xde, 0x53, 0x3b, 0x9c, 0x76, 0xab, 0xcf, 0x1d, 0x04, 0x39, 0xfa, 0xef, 0xcc, 0xcc,
+  0x1d, 0x5a, 0x48, 0xc2, 0xc4, 0xe7, 0x79, 0xaa, 0x64, 0x48, 0xd2, 0x32, 0xe4, 0x87, 0x3d, 0x8b,
+  0x8c, 0xd7, 0xd0, 0x93, 0x40, 0x6e, 0x05, 0x3a, 0x75, 0x06, 0xde, 0xe9, 0x50, 0x3d, 0x4a, 0xfc,
+  0x82, 0x28, 0xd4, 0x8d, 0x92, 0xd0, 0x35, 0xe0, 0x52, 0x49, 0xa0, 0xf0, 0x95, 0x43, 0xbd, 0xd0,
+  0x56, 0xcd, 0x29, 0xb7, 0x37, 0x78, 0xe1, 0x94, 0xdb, 0x6f, 0x97, 0xa6, 0xa4, 0x7c, 0xaf, 0x94,
+  0x15, 0xc5, 0x09, 0x54, 0x6e, 0x93, 0xaf, 0x18, 0x11, 0xfd, 0xc6, 0xb5, 0x5f, 0xdf, 0xfa, 0xec,
+  0x5f, 0x0c, 0x36, 0x34, 0xa4, 0x4a, 0x68, 0x94, 0xc5, 0x6b, 0xbd, 0x7c, 0xb1, 0x84, 0x49, 0xc4,
+  0x90, 0x7a, 0x7e, 0x6c, 0x21, 0x26, 0x09, 0x03, 0x74, 0x7f, 0x3c, 0x3b, 0xea, 0xee, 0xc6, 0xd3,
+  0xfb, 0x0c, 0x5c, 0xe7, 0x07, 0xbc, 0x89, 0x28, 0x13, 0x30, 0x14, 0x45, 0x33, 0x0d, 0xe7, 0x66,
+  0x6a, 0xec, 0xfd, 0xec, 0xcf, 0x7a, 0x93, 0x92, 0x7d, 0x02, 0x32, 0xd1, 0xd4, 0xb7, 0x2f, 0xe3,
+  0xf9, 0xf4, 0x61, 0x7a, 0x7f, 0xde, 0x52, 0x43, 0xf7, 0x8c, 0xbd, 0x93, 0xfe, 0xe9, 0xc3, 0x71,
+  0x53, 0x91, 0xa0, 0x8f, 0xdb, 0xb6, 0xb1, 0xe3, 0xaf, 0x1b, 0x29, 0x8d, 0xa1, 0x73, 0x99, 0x33,
+  0xb3, 0x3f, 0x94, 0xec, 0xba, 0x8a, 0xab, 0xbf, 0xd2, 0x0c, 0xde, 0x55, 0x9a, 0x88, 0x7d, 0x72,
+  0xc8, 0x7e, 0xde, 0x28, 0xff, 0x6c, 0x51, 0x3a, 0x6e, 0xd9, 0x24, 0x76, 0x3a, 0xd6, 0x01, 0x23,
+  0x11, 0xff, 0xbd, 0x53, 0x33, 0xf3, 0xb5, 0x46, 0x0b, 0xf5, 0x9a, 0x96, 0x95, 0xae, 0xb1, 0xff,
+  0xa5, 0x4e, 0x9a, 0x93, 0xbd, 0xa8, 0xca, 0x92, 0xce, 0x72, 0xfc, 0x17, 0xf5, 0x63, 0xd3, 0x69,
+  0xdc, 0x13, 0x00, 0x00,
+};
+static const OTADashAsset otadash_css_asset = { "text/css", "gzip", otadash_css_gz, sizeof(otadash_css_gz), 5084, "9c061d01" };
+#else
+static const char otadash_css_text[] = R"rawliteral(body{color:var(--WEBPAGES_PRIMARY_COLOR);margin:0;padding:0;display:flex;text-align:center;font-family:"Arial";align-items:center;justify-content:center;background-color:var(--WEBPAGES_BACKGROUND_COLOR)}.container{width:90%;max-width:500px;min-width:300px;height:auto;padding:20px;display:flex;margin-top:50px;background:var(--WEBPAGES_BACKGROUND_2_COLOR);box-shadow:0 0 10px rgba(0,0,0,0.1);align-items:center;border-radius:10px;flex-direction:column}.button{color:var(--WEBPAGES_BUTTON_TEXT_COLOR);min-width:160px;width:auto;height:auto;cursor:pointer;border:none;margin:10px 8px;padding:12px 20px;display:inline-block;font-size:16px;text-align:center;border-radius:5px;text-decoration:none;background-color:var(--WEBPAGES_BUTTON_COLOR);box-sizing:border-box}.button-container{gap:10px;width:100%;display:flex;flex-wrap:wrap;justify-content:center;align-items:center}.note{color:var(--WEBPAGES_ACCENT_COLOR);font-size:14px;margin-top:10px}.note h5{margin-bottom:5px}.separator{width:100%;height:1px;margin:20px 0px;background-color:var(--WEBPAGES_ACCENT_COLOR)}.footer{color:var(--WEBPAGES_HEADER_FOOTER_COLOR);font-size:11px;margin-top:20px;border-top:1px solid var(--WEBPAGES_BORDER_COLOR);padding-top:15px}.footer a{color:var(--WEBPAGES_LINK_COLOR);text-decoration:none}.footer a:hover{text-decoration:underline}.content{text-align:left;margin:20px 0;font-size:14px;line-height:1.8}.header{text-align:center;margin-bottom:20px}.header h1{margin:0;color:var(--WEBPAGES_ACCENT_COLOR)}.header p{margin:5px 0;font-size:12px;color:var(--WEBPAGES_HEADER_FOOTER_COLOR)}.credits{background-color:var(--WEBPAGES_BACKGROUND_3_COLOR);padding:15px;border-radius:5px;margin:15px 0}.credits h3{margin-top:0;color:var(--WEBPAGES_ACCENT_COLOR);font-size:14px}.credits p{margin:8px 0;font-size:13px}.credits a{color:var(--WEBPAGES_LINK_COLOR);text-decoration:none}.credits a:hover{text-decoration:underline}table{width:100%;margin:20px 0;table-layout:fixed;border-collapse:collapse}th,td{border:1px solid var(--WEBPAGES_BORDER_COLOR);padding:10px;word-wrap:break-word;word-break:break-word;text-align:left;white-space:normal}th{text-align:center;background-color:var(--WEBPAGES_BACKGROUND_3_COLOR)}tr{height:50px}.wifi-list{width:100%;padding:10px;max-height:250px;overflow-y:auto;margin-top:20px;box-shadow:0 2px 4px rgba(0,0,0,0.1);margin-bottom:30px;border-radius:8px;background-color:var(--WEBPAGES_BACKGROUND_COLOR)}.wifi-item{cursor:pointer;padding:10px;border-bottom:1px solid var(--WEBPAGES_BORDER_COLOR)}.wifi-item:last-child{border-bottom:none}.wifi-item:hover{background-color:var(--WEBPAGES_BACKGROUND_3_COLOR)}h1{font-size:24px;margin-bottom:20px}.form-group{width:100%;margin-bottom:15px;display:flex;flex-direction:column}label{color:var(--WEBPAGES_ACCENT_COLOR);display:block;font-size:16px;text-align:left;margin-bottom:5px}input[type="text"],input[type="password"]{width:100%;border:1px solid var(--WEBPAGES_BORDER_COLOR);padding:8px;box-sizing:border-box;border-radius:4px;margin-bottom:10px}input[type="submit"]{cursor:pointer;margin:20px 5px;border:none;padding:12px 20px;font-size:16px;border-radius:5px;background-color:var(--WEBPAGES_ACCENT_1_COLOR);color:var(--WEBPAGES_TEXT_COLOR);text-decoration:none;display:inline-block;min-width:140px;width:auto;height:auto;text-align:center;box-sizing:border-box}input[type="file"]{padding:10px;border:2px dashed var(--WEBPAGES_ACCENT_1_COLOR);border-radius:5px;width:200px;cursor:pointer}.view{width:100%;display:flex;align-items:center;flex-direction:column}.view[hidden]{display:none}#progressContainer{width:100%;border:2px solid var(--WEBPAGES_ACCENT_1_COLOR);display:none;position:relative;margin-top:20px;border-radius:5px}#progressBar{width:0%;height:20px;position:relative;transition:width 0.4s ease;border-radius:5px;background-color:var(--WEBPAGES_ACCENT_1_COLOR)}#progressText{color:var(--WEBPAGES_TEXT_COLOR);top:0;left:0;width:100%;position:absolute;text-align:center;font-weight:bold;line-height:20px}.log-screen{border:1px solid var(--WEBPAGES_BORDER_COLOR);width:100%;max-width:350px;min-width:300px;height:400px;overflow-y:scroll;padding:10px;text-align:left;background-color:var(--WEBPAGES_BACKGROUND_4_COLOR);color:var(--WEBPAGES_TEXT_COLOR);box-sizing:border-box;font-family:monospace;font-size:12px;word-wrap:break-word;white-space:pre-wrap}.erase-submit{background-color:var(--WEBPAGES_DANGER_COLOR) !important}.erase-submit:hover{background-color:var(--WEBPAGES_DANGER_HOVER_COLOR) !important}.restart-submit{background-color:var(--WEBPAGES_WARNING_COLOR) !important}.restart-submit:hover{background-color:var(--WEBPAGES_WARNING_HOVER_COLOR) !important}.button:hover{background-color:var(--WEBPAGES_BUTTON_HOVER_COLOR)}@media (max-width:480px){.container{width:95%;margin-top:20px;padding:15px}.button{min-width:160px;font-size:14px;padding:10px 15px;margin:8px 3px}input[type="submit"]{min-width:160px;font-size:14px;padding:10px 15px}.log-screen{height:300px;background-color:var(--WEBPAGES_BACKGROUND_4_COLOR);color:var(--WEBPAGES_TEXT_COLOR);word-wrap:break-word;white-space:pre-wrap}h1{font-size:20px}})rawliteral";
+static const OTADashAsset otadash_css_asset = { "text/css", nullptr, reinterpret_cast<const uint8_t*>(otadash_css_text), sizeof(otadash_css_text) - 1, 5084, "9c061d01" };
+#endif
+
+#endif // WEBPAGES_ASSETS_H
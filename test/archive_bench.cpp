@@ -0,0 +1,232 @@
+/*
+ ====================================================================================================
+ * File:        archive_bench.cpp
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.1.0
+ * Date:        Oct 17 2026
+ * Brief:       Host Benchmark For The Compressed Debug Log Archive
+ *
+ ====================================================================================================
+ * Replays a captured ESP32 boot followed by many rounds of its main loop, with the readings
+ * in every round drifting the way sensor values do, through OTADashLogBuffer and
+ * OTADashLogArchive. Checks that every line comes back unchanged, checks
+ * unpack(pack(x)) == x around the block boundaries, reports the cost per line and fails
+ * when the archive holds less than ARCHIVE_RATIO_MIN times its size in ring records.
+ *
+ * Usage:
+ *   make -C test bench
+ *   test/build/archive_bench [boot log] [loop log] [rounds]
+ ====================================================================================================
+ */
+
+#include "OTADashLog.h"
+#include "check.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+static const double ARCHIVE_RATIO_MIN = 5.0;
+
+struct SessionLine {
+    uint8_t     level;
+    uint32_t    timestamp;
+    std::string tag;
+    std::string text;
+};
+
+static double elapsedNs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool loadSession(const char* path, std::vector<SessionLine>& lines) {                                        // "L (ms) tag: text", the ESP-IDF console format
+    static const char levels[] = "NEWIDV";
+    std::ifstream file(path);
+    std::string text;
+
+    while (std::getline(file, text)) {
+        size_t open  = text.find(" (");
+        size_t close = text.find(") ", open);
+        size_t colon = text.find(':', close);
+        if (text.size() < 4 || open != 1 || close == std::string::npos || colon == std::string::npos) {
+            continue;
+        }
+        const char* level = strchr(levels, text[0]);
+        size_t body = colon + 1 < text.size() && text[colon + 1] == ' ' ? colon + 2 : colon + 1;
+        size_t tag  = colon - close - 2 < OTA_DASH_LOG_TAG_MAX ? colon - close - 2 : OTA_DASH_LOG_TAG_MAX;           // The ring truncates longer tags
+        lines.push_back({
+            static_cast<uint8_t>(level ? level - levels : static_cast<int>(DEBUG_LEVEL_INFO)),
+            static_cast<uint32_t>(strtoul(text.c_str() + open + 2, nullptr, 10)),
+            text.substr(close + 2, tag),
+            text.substr(body)
+        });
+    }
+    return !lines.empty();
+}
+
+static void drift(std::string& text, uint32_t& seed) {                                                              // Nudge the last digit of every number, the way a reading moves
+    static const int steps[] = { 0, 0, 1, 9 };
+    auto alnum = [&](size_t i) { return i < text.size() && isalnum(static_cast<uint8_t>(text[i])); };
+    auto digit = [&](size_t i) { return i < text.size() && isdigit(static_cast<uint8_t>(text[i])); };
+
+    for (size_t start = 0; start < text.size(); start++) {
+        if (!digit(start) || (start > 0 && alnum(start - 1))) {
+            continue;
+        }
+        size_t end = start;                                                                                         // Last digit of "1012.6", not of "0x76" or "I2C"
+        while (digit(end + 1) || (text[end + 1] == '.' && digit(end + 2))) {
+            end++;
+        }
+        if (!alnum(end + 1)) {
+            seed      = seed * 1664525u + 1013904223u;
+            text[end] = static_cast<char>('0' + (text[end] - '0' + steps[seed >> 30]) % 10);
+        }
+        start = end;
+    }
+}
+
+static void checkRoundTrip(const std::vector<uint8_t>& input, size_t start, size_t length, uint16_t* table) {
+    std::vector<uint8_t> packed(length + length / 32 + 16);
+    std::vector<uint8_t> unpacked(length + 1);
+
+    size_t packedLength = OTADashLogArchive::pack(input.data() + start, length, packed.data(), packed.size(), table);
+    CHECK(packedLength > 0, "pack of %zu bytes at %zu failed", length, start);
+    size_t unpackedLength = OTADashLogArchive::unpack(packed.data(), packedLength, unpacked.data(), length);
+    CHECK(unpackedLength == length && memcmp(unpacked.data(), input.data() + start, length) == 0,
+          "unpack(pack(x)) != x for %zu bytes at %zu", length, start);
+
+    if (packedLength > 1) {                                                                                         // One byte short must fail, not overrun
+        CHECK(OTADashLogArchive::pack(input.data() + start, length, packed.data(), packedLength - 1, table) == 0,
+              "pack of %zu bytes at %zu ignored outSize", length, start);
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* bootPath = argc > 1 ? argv[1] : "data/esp32_boot.log";
+    const char* loopPath = argc > 2 ? argv[2] : "data/esp32_loop.log";
+    int rounds           = argc > 3 ? atoi(argv[3]) : 60;
+    std::vector<SessionLine> boot;
+    std::vector<SessionLine> loop;
+    if (!loadSession(bootPath, boot) || !loadSession(loopPath, loop)) {
+        fprintf(stderr, "No log lines in %s or %s\n", bootPath, loopPath);
+        return 2;
+    }
+
+    std::vector<SessionLine> lines(boot);                                                                           // Boot once, then the loop with later timestamps
+    uint32_t span = loop.back().timestamp - loop.front().timestamp + 1000;
+    uint32_t seed = 2166136261u;
+    for (int round = 0; round < rounds; round++) {
+        for (const SessionLine& line : loop) {
+            lines.push_back(line);
+            lines.back().timestamp += round * span;
+            if (round > 0 && (line.tag == "sensor" || line.tag == "app" || line.tag == "mqtt")) {                   // Readings change, addresses and ids do not
+                drift(lines.back().text, seed);
+            }
+        }
+    }
+
+    // Round trips around the block boundaries, over the records as the ring holds them
+    std::vector<uint8_t> records;
+    uint32_t sequence = 1;
+    for (const SessionLine& line : lines) {
+        OTADashLogRecord record = { sequence++, line.timestamp, static_cast<uint16_t>(line.tag.size() + line.text.size()),
+                                    line.level, 1, static_cast<uint8_t>(line.tag.size()) };
+        const uint8_t* header = reinterpret_cast<const uint8_t*>(&record);
+        records.insert(records.end(), header, header + sizeof(record));
+        records.insert(records.end(), line.tag.begin(), line.tag.end());
+        records.insert(records.end(), line.text.begin(), line.text.end());
+    }
+
+    std::vector<uint16_t> table(OTA_DASH_LOG_ARCHIVE_TABLE_SIZE);
+    const size_t block     = OTA_DASH_LOG_ARCHIVE_BLOCK;
+    const size_t lengths[] = { 1, 2, 3, 4, 32, 33, 34, 262, 263, 289, block - 1, block };                           // Either side of every length limit
+    const size_t starts[]  = { 0, 1, block - 1, block, block + 1, 3 * block - 7 };
+    for (size_t start : starts) {
+        for (size_t length : lengths) {
+            if (start + length <= records.size()) {
+                checkRoundTrip(records, start, length, table.data());
+            }
+        }
+    }
+
+    std::vector<uint8_t> noise(block);                                                                              // Incompressible, must still round trip
+    for (uint8_t& byte : noise) {
+        seed  = seed * 1664525u + 1013904223u;
+        byte  = static_cast<uint8_t>(seed >> 24);
+    }
+    checkRoundTrip(noise, 0, block, table.data());
+
+    // Ring buffer and archive, the way otaDashTask drives them
+    OTADashLogBuffer ring;
+    OTADashLogArchive archive;
+    ring.begin(OTA_DASH_LOG_BUFFER_SIZE);
+    size_t archiveSize = 1;
+    while (archiveSize < records.size() * 2) archiveSize <<= 1;                                                      // Large enough that nothing is dropped
+    CHECK(archive.begin(archiveSize, ring.first()), "archive.begin(%zu) failed", archiveSize);
+
+    double appendNs  = 0;
+    double captureNs = 0;
+    size_t textBytes = 0;
+    for (size_t i = 0; i < lines.size(); i++) {
+        const SessionLine& line = lines[i];
+        auto start = std::chrono::steady_clock::now();
+        ring.append(line.tag.c_str(), line.text.c_str(), line.text.size(), line.timestamp, line.level, 1);
+        appendNs += elapsedNs(start);
+        textBytes += line.tag.size() + line.text.size();
+
+        if (i % 8 == 7 || i + 1 == lines.size()) {                                                                  // A batch per flush interval
+            start = std::chrono::steady_clock::now();
+            archive.capture(ring);
+            captureNs += elapsedNs(start);
+        }
+    }
+
+    OTADashLogRecord record;
+    char out[OTA_DASH_LOG_PAYLOAD_MAX + 1];
+    uint32_t next = archive.firstSequence();
+    size_t index  = next - 1;
+    CHECK(next == 1, "archive starts at #%u, expected #1", next);
+
+    auto start = std::chrono::steady_clock::now();
+    while (archive.read(next, record, out, sizeof(out))) {
+        const SessionLine& line = lines[index];
+        std::string expected = line.tag + line.text;
+        CHECK(record.sequence == index + 1, "read #%u, expected #%zu", record.sequence, index + 1);
+        CHECK(record.length == expected.size() && memcmp(out, expected.data(), expected.size()) == 0,
+              "line #%u differs after the archive", record.sequence);
+        CHECK(record.timestamp == line.timestamp && record.level == line.level && record.tagLength == line.tag.size(),
+              "header of #%u differs after the archive", record.sequence);
+        index++;
+    }
+    double readNs   = elapsedNs(start);
+    size_t archived = index;
+
+    uint32_t cursor = ring.seek(next);                                                                              // The newest lines are only in the ring
+    while (ring.read(cursor, record, out, sizeof(out))) {
+        CHECK(record.sequence == index + 1 && std::string(out) == lines[index].tag + lines[index].text,
+              "ring read #%u, expected #%zu", record.sequence, index + 1);
+        index++;
+    }
+    CHECK(index == lines.size(), "read back %zu of %zu lines", index, lines.size());
+
+    double ratio = (double)archive.rawBytes() / archive.packedBytes();
+    size_t count = lines.size();
+    printf("lines                 %zu (%zu boot, %zu per round, %d rounds)\n", count, boot.size(), loop.size(), rounds);
+    printf("text                  %zu bytes, %.1f per line\n", textBytes, (double)textBytes / count);
+    printf("archived              %zu lines, %zu ring bytes -> %zu bytes, %.1f per line\n",
+           archived, archive.rawBytes(), archive.packedBytes(), (double)archive.packedBytes() / archived);
+    printf("ratio                 %.2fx (at least %.1fx)\n", ratio, ARCHIVE_RATIO_MIN);
+    printf("append                %.0f ns per line\n", appendNs / count);
+    printf("capture and pack      %.0f ns per line\n", captureNs / count);
+    printf("read and unpack       %.0f ns per line\n", readNs / archived);
+    CHECK(ratio >= ARCHIVE_RATIO_MIN, "archive ratio %.2fx is below %.1fx", ratio, ARCHIVE_RATIO_MIN);
+
+    if (failures > 0) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("round trips OK\n");
+    return 0;
+}
@@ -0,0 +1,29 @@
+/*
+ ====================================================================================================
+ * File:        check.h
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.1.0
+ * Date:        Oct 17 2026
+ * Brief:       Minimal Assertions Shared By The Host Tests And Benchmarks
+ *
+ ====================================================================================================
+ */
+
+#ifndef OTADASH_TEST_CHECK_H
+#define OTADASH_TEST_CHECK_H
+
+#include <cstdio>
+
+static int failures = 0;
+
+#define CHECK(condition, ...)                                                                                       \
+    do {                                                                                                            \
+        if (!(condition)) {                                                                                         \
+            failures++;                                                                                             \
+            fprintf(stderr, "FAIL %s:%d: ", __FILE__, __LINE__);                                                    \
+            fprintf(stderr, __VA_ARGS__);                                                                           \
+            fputc('\n', stderr);                                                                                    \
+        }                                                                                                           \
+    } while (0)
+
+#endif // OTADASH_TEST_CHECK_H
@@ -0,0 +1,52 @@
+/*
+ ====================================================================================================
+ * File:        Arduino.h
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.1.0
+ * Date:        Oct 17 2026
+ * Brief:       Just Enough Of The Arduino Core To Build The Log And Template Sources On A Host
+ *
+ ====================================================================================================
+ * The host builds are single threaded, so the critical sections compile away. Only the
+ * sources that do not touch Wi-Fi, the web server or FreeRTOS are built against this file.
+ ====================================================================================================
+ */
+
+#ifndef OTADASH_HOST_ARDUINO_H
+#define OTADASH_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+typedef struct {
+    int owner;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    { 0 }
+#define portENTER_CRITICAL(mux)         ((void)(mux))
+#define portEXIT_CRITICAL(mux)          ((void)(mux))
+
+class Print {
+public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t written = 0;
+        while (written < size && write(buffer[written])) written++;
+        return written;
+    }
+    size_t write(const char* text) { return text ? write(reinterpret_cast<const uint8_t*>(text), strlen(text)) : 0; }
+    size_t print(const char* text) { return write(text); }
+};
+
+class String : public std::string {
+public:
+    using std::string::basic_string;
+    String(const char* text = "") : std::string(text ? text : "") {}
+    bool isEmpty() const { return empty(); }
+};
+
+#endif // OTADASH_HOST_ARDUINO_H
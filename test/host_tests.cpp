@@ -0,0 +1,241 @@
+/*
+ ====================================================================================================
+ * File:        host_tests.cpp
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.1.0
+ * Date:        Oct 17 2026
+ * Brief:       Host Tests For The Log Buffer, Log Archive, Tag Filters And Page Templates
+ *
+ ====================================================================================================
+ * Usage:
+ *   make -C test test
+ ====================================================================================================
+ */
+
+#include "OTADashLog.h"
+#include "OTADashTemplate.h"
+#include "check.h"
+
+#include <string>
+#include <vector>
+
+static std::string readText(OTADashLogBuffer& log, uint32_t& cursor, OTADashLogRecord& record) {
+    char out[OTA_DASH_LOG_PAYLOAD_MAX + 1];
+    return log.read(cursor, record, out, sizeof(out)) ? std::string(out + record.tagLength) : std::string();
+}
+
+static void testBufferWrapAndEvict() {
+    OTADashLogBuffer log;
+    CHECK(log.begin(300), "begin failed");
+    CHECK(log.capacity() == 256, "capacity %zu, expected 256", log.capacity());
+
+    for (int i = 0; i < 200; i++) {                                                                                 // Many times round the ring, records straddle the end
+        std::string text = "line " + std::to_string(i) + std::string(i % 23, 'x');
+        log.append(i % 2 ? "odd" : nullptr, text.c_str(), text.size(), i * 10, DEBUG_LEVEL_INFO, 0);
+    }
+    CHECK(log.last() - log.first() <= log.capacity(), "ring holds %u bytes", log.last() - log.first());
+    CHECK(log.nextSequence() == 201, "next sequence %u", log.nextSequence());
+
+    OTADashLogRecord record;
+    uint32_t cursor   = log.first();
+    uint32_t expected = 0;
+    size_t   count    = 0;
+    char out[OTA_DASH_LOG_PAYLOAD_MAX + 1];
+    while (log.read(cursor, record, out, sizeof(out))) {
+        int index = static_cast<int>(record.sequence) - 1;
+        std::string text = "line " + std::to_string(index) + std::string(index % 23, 'x');
+        std::string tag  = index % 2 ? "odd" : "";
+        CHECK(expected == 0 || record.sequence == expected, "read #%u after #%u", record.sequence, expected - 1);
+        CHECK(std::string(out, record.tagLength) == tag && text == out + record.tagLength, "#%u corrupted: %s", record.sequence, out);
+        CHECK(record.timestamp == static_cast<uint32_t>(index * 10), "#%u timestamp %u", record.sequence, record.timestamp);
+        expected = record.sequence + 1;
+        count++;
+    }
+    CHECK(expected == 201, "newest read #%u, expected #200", expected - 1);
+    CHECK(count == log.count() && count > 1, "read %zu records, count() %zu", count, log.count());
+
+    log.setMaxRecords(3);
+    log.append("t", "a", 1, 0, DEBUG_LEVEL_INFO, 0);
+    CHECK(log.count() == 3, "count %zu with setMaxRecords(3)", log.count());
+
+    cursor = log.first();                                                                                           // Truncated copies still advance past the whole record
+    CHECK(log.read(cursor, record, out, 4) && record.length == 3 && strlen(out) == 3, "truncated read gave %u bytes", record.length);
+    CHECK(record.sequence == 199, "truncated read returned #%u", record.sequence);
+    CHECK(log.read(cursor, record, nullptr, 0) && record.sequence == 200, "header only read returned #%u", record.sequence);
+
+    log.clear();
+    cursor = log.first();
+    CHECK(log.count() == 0 && !log.read(cursor, record, out, sizeof(out)), "clear left records behind");
+}
+
+static void testBufferSeekAndRetry() {
+    OTADashLogBuffer log;
+    log.begin(256);
+    for (int i = 0; i < 6; i++) {
+        std::string text = "record " + std::to_string(i);
+        log.append(nullptr, text.c_str(), text.size(), i, DEBUG_LEVEL_INFO, 0);
+    }
+
+    OTADashLogRecord record;
+    uint32_t cursor = log.seek(4);
+    CHECK(readText(log, cursor, record) == "record 3" && record.sequence == 4, "seek(4) read #%u", record.sequence);
+    cursor = log.seek(0);
+    CHECK(cursor == log.first(), "seek(0) is not the oldest record");
+    CHECK(log.seek(99) == log.last(), "seek past the newest is not last()");
+
+    uint32_t stale = log.first();                                                                                   // A reader left behind while the writer laps it
+    for (int i = 6; i < 40; i++) {
+        std::string text = "record " + std::to_string(i);
+        log.append(nullptr, text.c_str(), text.size(), i, DEBUG_LEVEL_INFO, 0);
+    }
+    CHECK(static_cast<int32_t>(stale - log.first()) < 0, "the writer never passed the stale cursor");
+
+    OTADashLogRecord oldest;
+    uint32_t position = log.first();
+    readText(log, position, oldest);
+    std::string text = readText(log, stale, record);
+    CHECK(record.sequence == oldest.sequence, "stale reader resumed at #%u, oldest is #%u", record.sequence, oldest.sequence);
+    CHECK(text == "record " + std::to_string(oldest.sequence - 1), "stale reader read '%s'", text.c_str());
+
+    CHECK(log.seek(1) == log.first(), "seek to an evicted sequence is not the oldest record");
+}
+
+static void testArchiveRoundTrip() {
+    OTADashLogBuffer log;
+    OTADashLogArchive archive;
+    log.begin(1024);
+    CHECK(archive.begin(OTA_DASH_LOG_ARCHIVE_BLOCK * 8, log.first()), "archive begin failed");
+
+    std::vector<std::string> lines;
+    for (int i = 0; i < 400; i++) {                                                                                 // Several blocks, so records fill and cross block flushes
+        lines.push_back("heap " + std::to_string(200000 - i * 13) + " free, rssi -" + std::to_string(50 + i % 9) + " dBm");
+        log.append("app", lines.back().c_str(), lines.back().size(), i * 100, DEBUG_LEVEL_DEBUG, 1);
+        if (i % 5 == 4) {
+            archive.capture(log);
+        }
+    }
+    archive.capture(log);
+    CHECK(archive.packedBytes() < archive.rawBytes(), "archive did not compress (%zu -> %zu)", archive.rawBytes(), archive.packedBytes());
+
+    OTADashLogRecord record;
+    char out[OTA_DASH_LOG_PAYLOAD_MAX + 1];
+    uint32_t sequence = archive.firstSequence();
+    uint32_t first    = sequence;
+    size_t   count    = 0;
+    CHECK(sequence >= 1, "archive is empty");
+    while (archive.read(sequence, record, out, sizeof(out))) {
+        const std::string& line = lines[record.sequence - 1];
+        CHECK(record.sequence == first + count, "archive read #%u, expected #%zu", record.sequence, first + count);
+        CHECK(std::string(out, 3) == "app" && line == out + record.tagLength, "archived #%u corrupted: %s", record.sequence, out);
+        CHECK(record.timestamp == (record.sequence - 1) * 100 && record.level == DEBUG_LEVEL_DEBUG && record.core == 1,
+              "archived #%u header corrupted", record.sequence);
+        count++;
+    }
+    uint32_t next = first + count;                                                                                  // The ring holds the rest, with no gap after the archive
+    uint32_t cursor = log.seek(next);
+    CHECK(readText(log, cursor, record) == lines[next - 1] && record.sequence == next, "ring does not continue at #%u", next);
+    CHECK(log.last() - log.seek(next) < log.capacity() - log.capacity() / 4, "archive stopped at #%u, short of the oldest quarter", next - 1);
+    CHECK(log.last() - log.seek(next - 1) >= log.capacity() - log.capacity() / 4, "archive took #%u, newer than the oldest quarter", next - 1);
+
+    sequence = 250;                                                                                                 // Random access lands on the right record
+    CHECK(first <= 250 && archive.read(sequence, record, out, sizeof(out)) && record.sequence == 250, "read from #250 returned #%u", record.sequence);
+
+    log.clear();                                                                                                    // With a record limit the count decides what is old
+    log.setMaxRecords(20);
+    archive.begin(OTA_DASH_LOG_ARCHIVE_BLOCK * 8, log.first());
+    uint32_t base = log.nextSequence();
+    for (int i = 0; i < 100; i++) {
+        log.append("app", "tick", 4, i, DEBUG_LEVEL_INFO, 0);
+        archive.capture(log);
+    }
+    for (sequence = archive.firstSequence(), count = 0; archive.read(sequence, record, out, sizeof(out)); count++) {
+        CHECK(record.sequence == base + count && std::string(out) == "apptick", "limited archive read #%u", record.sequence);
+    }
+    CHECK(count == 100 - 15 + 1, "archived %zu of 100 records with a limit of 20, expected 86", count);
+
+    uint8_t packed[64];
+    uint8_t unpacked[64];
+    uint16_t table[OTA_DASH_LOG_ARCHIVE_TABLE_SIZE];
+    const char* repeated = "abcabcabcabcabcabcabcabcabcabcabcabc";                                                    // Overlapping match
+    size_t length = OTADashLogArchive::pack(reinterpret_cast<const uint8_t*>(repeated), strlen(repeated), packed, sizeof(packed), table);
+    CHECK(length > 0 && length < strlen(repeated), "overlapping input packed to %zu bytes", length);
+    CHECK(OTADashLogArchive::unpack(packed, length, unpacked, sizeof(unpacked)) == strlen(repeated) &&
+          memcmp(unpacked, repeated, strlen(repeated)) == 0, "overlapping match did not round trip");
+    CHECK(OTADashLogArchive::unpack(packed, length, unpacked, 8) == 0, "unpack ignored outSize");
+    const uint8_t corrupt[] = { 0x80, 0x10, 0x00 };                                                                 // Match before any output
+    CHECK(OTADashLogArchive::unpack(corrupt, sizeof(corrupt), unpacked, sizeof(unpacked)) == 0, "unpack accepted a bad distance");
+    const uint8_t repeat[] = { 0x00, 'a', 0x20 };                                                                   // Repeat before any match
+    CHECK(OTADashLogArchive::unpack(repeat, sizeof(repeat), unpacked, sizeof(unpacked)) == 0, "unpack repeated a missing distance");
+}
+
+static bool tags(const char* list, const char* tag) {
+    return otaDashMatchesTagList(list, tag, strlen(tag));
+}
+
+static void testTagLists() {
+    CHECK(tags("wifi", "wifi"), "exact tag");
+    CHECK(!tags("wifi", "wifi2") && !tags("wifi2", "wifi"), "tags only match whole");
+    CHECK(tags("wifi, ota*", "ota_update") && tags("ota*", "ota"), "prefix tag");
+    CHECK(!tags("ota*", "ot"), "prefix longer than the tag");
+    CHECK(tags(" sensor ,x", "sensor") && tags("a,,b", "b"), "spaces and empty entries");
+    CHECK(!tags(",,", "") && !tags("", "wifi"), "an empty list matches nothing");
+    CHECK(tags("*", "") && tags("*", "anything"), "a lone * matches every tag");
+}
+
+static constexpr char adjacentSource[] = "%PORTAL_HEADING%%CUSTOM_DOMAIN%";
+static constexpr char straySource[]    = "100% of %PORTAL_HEADING% at 5%%";
+static constexpr char endSource[]      = "<p>%CUSTOM_CONTENT%";
+static constexpr char unknownSource[]  = "%PORTAL_HEADING% %NOT_A_SLOT%";
+
+static_assert(templateSegmentCount(adjacentSource) == 2, "Adjacent markers need no text between them");
+static_assert(templateSegmentCount(straySource) == 3, "A stray % is plain text");
+static_assert(templateSegmentCount(endSource) == 2, "A marker may end the page");
+static_assert(templateSegmentCount("no markers") == 1 && templateSegmentCount("") == 0, "Plain pages are one span");
+static_assert(templateSegmentCount("%portal_heading% %_%") == 1, "Lower case names are not markers");
+static_assert(!templateIsValid(unknownSource) && templateIsValid(straySource), "Unknown markers are rejected");
+
+OTA_DASH_TEMPLATE(adjacentTemplate, adjacentSource);
+OTA_DASH_TEMPLATE(strayTemplate, straySource);
+OTA_DASH_TEMPLATE(endTemplate, endSource);
+
+static std::string render(const OTADashTemplate& page, const TemplateValue* values, size_t chunk) {
+    TemplateCursor cursor;
+    std::string out;
+    uint8_t buffer[256];
+    size_t length;
+    while ((length = page.render(buffer, chunk, cursor, values)) > 0) {
+        out.append(reinterpret_cast<char*>(buffer), length);
+    }
+    return out;
+}
+
+static void testTemplates() {
+    const TemplateValue values[TEMPLATE_SLOT_COUNT] = { { "Pump", 4 }, { "pump.local", 10 }, { "", 0 } };
+    for (size_t chunk : { 1, 3, 256 }) {                                                                            // Chunks split values and text at every offset
+        CHECK(render(adjacentTemplate, values, chunk) == "Pumppump.local", "adjacent markers, chunk %zu", chunk);
+        CHECK(render(strayTemplate, values, chunk) == "100% of Pump at 5%%", "stray %%, chunk %zu", chunk);
+        CHECK(render(endTemplate, values, chunk) == "<p>", "empty value at the end, chunk %zu", chunk);
+    }
+
+    TemplateCursor cursor;                                                                                          // A value that shrank mid-response must not be over-read
+    cursor.segment = 0;
+    cursor.offset  = 9;
+    uint8_t buffer[32];
+    size_t length = adjacentTemplate.render(buffer, sizeof(buffer), cursor, values);
+    CHECK(length == 10 && memcmp(buffer, "pump.local", 10) == 0, "cursor past a shorter value rendered %zu bytes", length);
+}
+
+int main() {
+    testBufferWrapAndEvict();
+    testBufferSeekAndRetry();
+    testArchiveRoundTrip();
+    testTagLists();
+    testTemplates();
+
+    if (failures > 0) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("host tests OK\n");
+    return 0;
+}
@@ -0,0 +1,186 @@
+"""
+ ====================================================================================================
+ * File:        build_assets.py
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.1.0
+ * Date:        Oct 17 2026
+ * Brief:       Generates src/WebAssets.h, the only copy of the static pages and the base stylesheet
+ *
+ ====================================================================================================
+ * Sources:
+ *   web pages/<page>.html      pages without %SLOT% markers (templated pages stay in WebPages.h)
+ *   styles/otadash style.css   the base stylesheet, colours come from /theme.css at runtime
+ *
+ * Each asset is emitted twice, gzip under OTA_DASH_GZIP_ASSETS and minified text otherwise, so
+ * the firmware stores one of them and --check catches any drift from the sources.
+ *
+ * Usage:
+ *   python3 tools/build_assets.py [--check]
+ *   PlatformIO runs it automatically as the library extraScript (see library.json).
+ ====================================================================================================
+"""
+
+import gzip
+import hashlib
+import inspect
+import os
+import re
+import sys
+
+PAGES = {                                                   # web pages/<file> -> asset name in WebAssets.h
+    "info":         "device_info_html",
+    "wifimanage":   "wifi_manage_html",
+    "update":       "update_firmware_html",
+    "erase":        "erase_settings_html",
+    "restart":      "restart_device_html",
+    "about":        "about_html",
+    "app":          "app_html",
+}
+
+SLOT_RE     = re.compile(r'%[A-Z_]+%')
+RAW_END     = ')rawliteral"'
+
+
+def read(path):
+    with open(path, "r", encoding="utf-8") as handle:
+        return handle.read()
+
+
+def minify_css(css):
+    css = re.sub(r"/\*.*?\*/", "", css, flags=re.S)
+    parts = re.split(r'("[^"]*"|\'[^\']*\')', css)             # Leave quoted strings untouched
+    for i in range(0, len(parts), 2):
+        part = re.sub(r"\s+", " ", parts[i])
+        part = re.sub(r"\s*([{};,>])\s*", r"\1", part)
+        part = re.sub(r":\s+", ":", part)                     # Only after ':', a space before it is a selector
+        parts[i] = part.replace(";}", "}")
+    return "".join(parts).strip()
+
+
+def minify_html(html):
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    lines = (line.strip() for line in html.splitlines())      # Newlines stay, inline scripts use // comments
+    return "\n".join(line for line in lines if line)
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:8]
+
+
+def compress(data):
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def emit_array(name, data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "static const uint8_t %s[] = {\n%s\n};\n" % (name, "\n".join(rows))
+
+
+def emit_text(name, data):
+    text = data.decode("utf-8")
+    if RAW_END in text:
+        raise SystemExit("build_assets: %s contains %s" % (name, RAW_END))
+    return "static const char %s[] = R\"rawliteral(%s)rawliteral\";\n" % (name, text)
+
+
+def generate(root):
+    css     = minify_css(read(os.path.join(root, "styles", "otadash style.css"))).encode("utf-8")
+    assets  = []
+    for page, literal in PAGES.items():
+        html = read(os.path.join(root, "web pages", page + ".html"))
+        if SLOT_RE.search(html):
+            raise SystemExit("build_assets: %s.html has template markers, it cannot be precompressed" % page)
+        html = html.replace('href="/styles.css"', 'href="/styles.css?v=%s"' % content_hash(css))  # Versioned, cached long term
+        assets.append((literal, "text/html", minify_html(html).encode("utf-8")))
+    assets.append(("otadash_css", "text/css", css))
+
+    out = []
+    out.append("/*\n"
+               " ====================================================================================================\n"
+               " * File:        WebAssets.h\n"
+               " * Brief:       Minified web assets, gzip-precompressed unless OTA_DASH_GZIP_ASSETS is 0.\n"
+               " *              Generated by tools/build_assets.py, do not edit.\n"
+               " *              Sources are the \"web pages/\" html files and \"styles/otadash style.css\".\n"
+               " ====================================================================================================\n"
+               " */\n\n"
+               "#ifndef WEBPAGES_ASSETS_H\n"
+               "#define WEBPAGES_ASSETS_H\n\n"
+               "#include <stdint.h>\n"
+               "#include <stddef.h>\n\n"
+               "#ifndef OTA_DASH_GZIP_ASSETS\n"
+               "    #error \"Include OTADash.h before WebAssets.h\"\n"
+               "#endif\n\n"
+               "struct OTADashAsset {\n"
+               "    const char*     type;\n"
+               "    const char*     encoding;                                                                           // Content-Encoding, nullptr for plain text\n"
+               "    const uint8_t*  data;\n"
+               "    size_t          length;\n"
+               "    size_t          rawLength;                                                                          // Minified, before compression\n"
+               "    const char*     hash;                                                                               // First 8 hex digits of the minified content's SHA-256, used as ETag\n"
+               "};\n\n")
+
+    total_raw = total_gz = 0
+    for name, content_type, data in assets:
+        packed      = compress(data)
+        digest      = content_hash(data)
+        total_raw  += len(data)
+        total_gz   += len(packed)
+        out.append("// %s: %d bytes minified, %d bytes gzip\n" % (name, len(data), len(packed)))
+        out.append("#if OTA_DASH_GZIP_ASSETS\n")
+        out.append(emit_array(name + "_gz", packed))
+        out.append('static const OTADashAsset %s_asset = { "%s", "gzip", %s_gz, sizeof(%s_gz), %d, "%s" };\n'
+                   % (name, content_type, name, name, len(data), digest))
+        out.append("#else\n")
+        out.append(emit_text(name + "_text", data))
+        out.append('static const OTADashAsset %s_asset = { "%s", nullptr, reinterpret_cast<const uint8_t*>(%s_text), sizeof(%s_text) - 1, %d, "%s" };\n'
+                   % (name, content_type, name, name, len(data), digest))
+        out.append("#endif\n\n")
+
+    out.append("#endif // WEBPAGES_ASSETS_H\n")
+    return "".join(out), total_raw, total_gz
+
+
+def write_if_changed(path, content):
+    try:
+        if read(path) == content:
+            return False
+    except OSError:
+        pass
+    with open(path, "w", encoding="utf-8", newline="\n") as handle:
+        handle.write(content)
+    return True
+
+
+def run(root, check=False):
+    content, raw, packed = generate(root)
+    target = os.path.join(root, "src", "WebAssets.h")
+    if check:
+        current = read(target) if os.path.exists(target) else ""
+        if current != content:
+            print("build_assets: src/WebAssets.h is out of date, run tools/build_assets.py")
+            return 1
+        return 0
+    if write_if_changed(target, content):
+        print("build_assets: wrote src/WebAssets.h (%d -> %d bytes, %d%% smaller)"
+              % (raw, packed, 100 - packed * 100 // max(raw, 1)))
+    return 0
+
+
+def library_root():                                         # Not the cwd, SCons runs extraScripts from their own directory
+    try:
+        Import("pio_lib_builder")                           # noqa: F821
+        return pio_lib_builder.path                         # noqa: F821
+    except Exception:
+        script = inspect.getframeinfo(inspect.currentframe()).filename
+        return os.path.dirname(os.path.dirname(os.path.abspath(script)))
+
+
+try:                                                        # PlatformIO library extraScript
+    Import("env")                                           # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        sys.exit(run(library_root(), "--check" in sys.argv))
+else:
+    run(library_root())